@@ -298,6 +298,16 @@ def addCommonOptions(parser):
     parser.add_option("-F", "--fast-forward", action="store", type="string",
         default=None,
         help="Number of instructions to fast forward before switching")
+    ### MPINHO 17-oct-2026 BEGIN ###
+    parser.add_option("--fast-forward-block-cache", action="store_true",
+        default=False,
+        help="Cache decoded basic blocks in the fast-forwarding atomic CPU"
+             " (SE mode only)")
+    parser.add_option("--fast-forward-block-cache-check", action="store_true",
+        default=False,
+        help="Also fetch and decode the instructions found in the block"
+             " cache, and stop if they differ")
+    ### MPINHO 17-oct-2026 END ###
     parser.add_option("-S", "--simpoint", action="store_true", default=False,
         help="""Use workload simpoints as an instruction offset for
                 --checkpoint-restore or --take-checkpoint.""")
@@ -330,6 +340,50 @@ def addCommonOptions(parser):
                                    'MultiElement'],
                           help="Criteria to accept the packing of"
                                " two operations.")
+
+        ### MPINHO 17-oct-2026 BEGIN ###
+        parser.add_option("--width-rename", action="store_true",
+                          default=False, help="Allocate vector results in"
+                          " register slices according to their width.")
+
+        parser.add_option("--width-hold-back", action="store", type="int",
+                          default=0, help="Maximum cycles a fuseable"
+                          " instruction waits for a predicted fuse partner.")
+
+        parser.add_option("--fu-gating", action="store", type="choice",
+                          default="Disabled",
+                          choices=['Disabled', 'Timeout', 'Predictive'],
+                          help="Policy to power off idle SIMD FUs.")
+
+        parser.add_option("--fu-steering", action="store", type="choice",
+                          default="RoundRobin",
+                          choices=['RoundRobin', 'Consolidate'],
+                          help="Policy to choose a free FU.")
+
+        parser.add_option("--quiescent-skip", action="store", type="int",
+                          default=0, help="Maximum cycles the O3 tick is"
+                          " skipped while the pipeline is quiescent.")
+
+        parser.add_option("--load-value-pred", action="store", type="choice",
+                          default="Disabled",
+                          choices=['Disabled', 'LastValue', 'Stride'],
+                          help="Policy of the O3 load value predictor.")
+
+        parser.add_option("--move-elim", action="store_true",
+                          help="Eliminate moves and zeroing idioms at O3 "
+                          "rename.")
+
+        parser.add_option("--macro-op-fusion", action="append",
+                          type="choice", default=[],
+                          choices=['CmpBranch', 'AdrpAdd', 'AeseAesmc',
+                                   'AesdAesimc'],
+                          help="Instruction pair fused into one macro-op at"
+                          " O3 decode (can be repeated).")
+
+        parser.add_option("--ftq-size", action="store", type="int",
+                          default=0, help="Fetch target queue entries of the"
+                          " O3 decoupled front end (0 disables it).")
+        ### MPINHO 17-oct-2026 END ###
     ### MPINHO 08-may-2019 END ###
 
 
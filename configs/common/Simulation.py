@@ -116,6 +116,22 @@ def setWorkCountOptions(system, options):
     if options.work_cpus_checkpoint_count != None:
         system.work_cpus_ckpt_count = options.work_cpus_checkpoint_count
 
+### MPINHO 17-oct-2026 BEGIN ###
+def setBlockCache(options, cpu):
+    """Enables the decoded block cache of a fast-forwarding CPU, if asked
+    for. Only AtomicSimpleCPU has one."""
+
+    if not options.fast_forward_block_cache:
+        return
+
+    if isinstance(cpu, AtomicSimpleCPU):
+        cpu.block_cache = True
+        cpu.block_cache_check = options.fast_forward_block_cache_check
+    else:
+        warn("%s has no block cache, ignoring --fast-forward-block-cache" %
+             cpu.type)
+### MPINHO 17-oct-2026 END ###
+
 def findCptDir(options, cptdir, testsys):
     """Figures out the directory from which the checkpointed state is read.
 
@@ -466,6 +482,23 @@ def run(options, root, testsys, cpu_class):
             testsys.cpu[i].widthDefinition = options.width_define
             testsys.cpu[i].widthBlockSize = options.width_block
             testsys.cpu[i].widthPackingPolicy = options.packing_policy
+            ### MPINHO 17-oct-2026 BEGIN ###
+            testsys.cpu[i].widthAwareRename = options.width_rename
+            testsys.cpu[i].widthHoldBackCycles = options.width_hold_back
+            testsys.cpu[i].fuPool.gatingPolicy = options.fu_gating
+            testsys.cpu[i].fuPool.steeringPolicy = options.fu_steering
+            testsys.cpu[i].quiescentSkipCycles = options.quiescent_skip
+            testsys.cpu[i].loadValuePredPolicy = options.load_value_pred
+            testsys.cpu[i].moveElimination = options.move_elim
+            testsys.cpu[i].macroOpFusionPairs = options.macro_op_fusion
+            testsys.cpu[i].fetchTargetQueueSize = options.ftq_size
+            ### MPINHO 17-oct-2026 END ###
+        ### MPINHO 17-oct-2026 BEGIN ###
+        elif isinstance(testsys.cpu[i], m5.objects.MinorCPU):
+            testsys.cpu[i].widthDefinition = options.width_define
+            testsys.cpu[i].widthBlockSize = options.width_block
+            testsys.cpu[i].widthPackingPolicy = options.packing_policy
+        ### MPINHO 17-oct-2026 END ###
     ### MPINHO 08-may-2019 END ###
 
     if cpu_class:
@@ -475,6 +508,7 @@ def run(options, root, testsys, cpu_class):
         for i in range(np):
             if options.fast_forward:
                 testsys.cpu[i].max_insts_any_thread = int(options.fast_forward)
+                setBlockCache(options, testsys.cpu[i]) ### MPINHO 17-oct-2026
             switch_cpus[i].system = testsys
             switch_cpus[i].workload = testsys.cpu[i].workload
             switch_cpus[i].clk_domain = testsys.cpu[i].clk_domain
@@ -496,6 +530,24 @@ def run(options, root, testsys, cpu_class):
                 switch_cpus[i].widthDefinition = options.width_define
                 switch_cpus[i].widthBlockSize = options.width_block
                 switch_cpus[i].widthPackingPolicy = options.packing_policy
+                ### MPINHO 17-oct-2026 BEGIN ###
+                switch_cpus[i].widthAwareRename = options.width_rename
+                switch_cpus[i].widthHoldBackCycles = options.width_hold_back
+                switch_cpus[i].fuPool.gatingPolicy = options.fu_gating
+                switch_cpus[i].fuPool.steeringPolicy = options.fu_steering
+                switch_cpus[i].quiescentSkipCycles = options.quiescent_skip
+                switch_cpus[i].loadValuePredPolicy = \
+                    options.load_value_pred
+                switch_cpus[i].moveElimination = options.move_elim
+                switch_cpus[i].macroOpFusionPairs = options.macro_op_fusion
+                switch_cpus[i].fetchTargetQueueSize = options.ftq_size
+                ### MPINHO 17-oct-2026 END ###
+            ### MPINHO 17-oct-2026 BEGIN ###
+            elif issubclass(cpu_class, m5.objects.MinorCPU):
+                switch_cpus[i].widthDefinition = options.width_define
+                switch_cpus[i].widthBlockSize = options.width_block
+                switch_cpus[i].widthPackingPolicy = options.packing_policy
+            ### MPINHO 17-oct-2026 END ###
             ### MPINHO 08-may-2019 END ###
 
         # If elastic tracing is enabled attach the elastic trace probe
@@ -562,6 +614,7 @@ def run(options, root, testsys, cpu_class):
             # Fast forward to specified location if we are not restoring
             elif options.fast_forward:
                 testsys.cpu[i].max_insts_any_thread = int(options.fast_forward)
+                setBlockCache(options, testsys.cpu[i]) ### MPINHO 17-oct-2026
             # Fast forward to a simpoint (warning: time consuming)
             elif options.simpoint:
                 if testsys.cpu[i].workload[0].simpoint == 0:
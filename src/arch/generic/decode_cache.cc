@@ -43,8 +43,10 @@ BasicDecodeCache::decode(TheISA::Decoder *decoder,
         TheISA::ExtMachInst mach_inst, Addr addr)
 {
     StaticInstPtr &si = decodePages.lookup(addr);
-    if (si && (si->machInst == mach_inst))
+    if (si && (si->machInst == mach_inst)) {
+        DecodeCache::counts.addrHits++; /// MPINHO 17-oct-2026 ///
         return si;
+    }
 
     auto iter = instMap.find(mach_inst);
     if (iter != instMap.end()) {
@@ -0,0 +1,150 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+#ifndef __BASE_POOL_ALLOC_HH__
+#define __BASE_POOL_ALLOC_HH__
+
+#include <cstddef>
+#include <new>
+
+/**
+ * Recycling pool of fixed size memory blocks. Released blocks are kept in a
+ * free list and handed out again by the next allocation, so a steady stream
+ * of short lived objects of the same size does not reach the system
+ * allocator. Blocks are carved out of chunks that are never returned.
+ *
+ * There is one pool per block size and per host thread, shared by every
+ * type with that size.
+ */
+template <size_t Size>
+class BlockPool
+{
+  private:
+    /** Blocks are kept aligned for any fundamental type. */
+    static constexpr size_t Align = alignof(std::max_align_t);
+
+    union Block
+    {
+        Block *next;
+        alignas(Align) char data[(Size + Align - 1) / Align * Align];
+    };
+
+    /** Number of blocks allocated at once when the free list is empty. */
+    static constexpr size_t ChunkBlocks = 256;
+
+    struct FreeList
+    {
+        Block *head;
+        size_t allocated;
+        size_t live;
+
+        FreeList() : head(nullptr), allocated(0), live(0) {}
+    };
+
+    static FreeList &
+    freeList()
+    {
+        static thread_local FreeList free_list;
+        return free_list;
+    }
+
+    static void
+    refill(FreeList &free_list)
+    {
+        Block *chunk = static_cast<Block *>(
+            ::operator new(ChunkBlocks * sizeof(Block)));
+
+        for (size_t i = 0; i < ChunkBlocks; ++i) {
+            chunk[i].next = free_list.head;
+            free_list.head = &chunk[i];
+        }
+        free_list.allocated += ChunkBlocks;
+    }
+
+  public:
+    /** Returns a block of at least Size bytes. */
+    static void *
+    allocate()
+    {
+        FreeList &free_list = freeList();
+
+        if (!free_list.head)
+            refill(free_list);
+
+        Block *block = free_list.head;
+        free_list.head = block->next;
+        ++free_list.live;
+        return block;
+    }
+
+    /** Returns a block obtained from allocate() to the pool. */
+    static void
+    release(void *ptr)
+    {
+        if (!ptr)
+            return;
+
+        FreeList &free_list = freeList();
+        Block *block = static_cast<Block *>(ptr);
+
+        block->next = free_list.head;
+        free_list.head = block;
+        --free_list.live;
+    }
+
+    /** Number of blocks ever carved out by this thread. */
+    static size_t allocated() { return freeList().allocated; }
+
+    /** Number of blocks of this thread currently in use. */
+    static size_t live() { return freeList().live; }
+};
+
+/**
+ * Standard allocator that takes single objects from a BlockPool. It is meant
+ * for node based containers such as std::list, whose nodes are then recycled
+ * instead of going through new and delete on every insert and erase. Array
+ * allocations go to the system allocator.
+ */
+template <class T>
+class PoolAllocator
+{
+  public:
+    typedef T value_type;
+
+    PoolAllocator() {}
+
+    template <class U>
+    PoolAllocator(const PoolAllocator<U> &) {}
+
+    T *
+    allocate(size_t n)
+    {
+        if (n == 1)
+            return static_cast<T *>(BlockPool<sizeof(T)>::allocate());
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+
+    void
+    deallocate(T *ptr, size_t n)
+    {
+        if (n == 1)
+            BlockPool<sizeof(T)>::release(ptr);
+        else
+            ::operator delete(ptr);
+    }
+};
+
+template <class T, class U>
+bool
+operator==(const PoolAllocator<T> &, const PoolAllocator<U> &)
+{
+    return true;
+}
+
+template <class T, class U>
+bool
+operator!=(const PoolAllocator<T> &, const PoolAllocator<U> &)
+{
+    return false;
+}
+
+#endif // __BASE_POOL_ALLOC_HH__
+/// MPINHO 17-oct-2026 END ///
@@ -0,0 +1,56 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <list>
+
+#include "base/pool_alloc.hh"
+
+TEST(PoolAllocTest, BlocksAreRecycled)
+{
+    typedef BlockPool<40> Pool;
+
+    void *first = Pool::allocate();
+    size_t allocated = Pool::allocated();
+    Pool::release(first);
+
+    // The last released block is the next one handed out.
+    void *second = Pool::allocate();
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(allocated, Pool::allocated());
+    Pool::release(second);
+}
+
+TEST(PoolAllocTest, BlocksAreAligned)
+{
+    typedef BlockPool<24> Pool;
+
+    void *blocks[8];
+    for (auto &block : blocks) {
+        block = Pool::allocate();
+        EXPECT_EQ(0, reinterpret_cast<uintptr_t>(block) %
+                     alignof(std::max_align_t));
+    }
+    for (auto &block : blocks)
+        Pool::release(block);
+}
+
+TEST(PoolAllocTest, ListWithPoolAllocator)
+{
+    std::list<int, PoolAllocator<int>> list;
+
+    for (int round = 0; round < 4; ++round) {
+        for (int i = 0; i < 1000; ++i)
+            list.push_back(i);
+        EXPECT_EQ(1000, list.size());
+        EXPECT_EQ(999, list.back());
+
+        list.remove_if([](int i) { return i % 2; });
+        EXPECT_EQ(500, list.size());
+        EXPECT_EQ(998, list.back());
+
+        list.clear();
+    }
+}
+/// MPINHO 17-oct-2026 END ///
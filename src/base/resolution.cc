@@ -1,23 +1,40 @@
 /// MPINHO 2-mar-2019 BEGIN ///
 
 #include "base/resolution.hh"
-#include "arch/utility.hh"
 
-int
-unsignedIntResolution(uint64_t val)
-{
-    if (val == 0) return 0;
+#include <cstring> /// MPINHO 17-oct-2026 ///
+#include <type_traits> /// MPINHO 17-oct-2026 ///
 
-    int prc = 1; // in findMsbSet they don't have this
-
-    if (val >> 32) { val += 32; val = val >> 32; }
+#include "arch/utility.hh"
+#include "base/logging.hh" /// MPINHO 17-oct-2026 ///
+
+/// MPINHO 17-oct-2026 BEGIN ///
+/**
+ * Position (starting in 1) of the most significant 1 bit, or zero for
+ * val == 0.
+ */
+static inline int
+msbPosition(uint64_t val)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return val ? 64 - __builtin_clzll(val) : 0;
+#else
+    int prc = 0;
+    if (val >> 32) { prc += 32; val = val >> 32; }
     if (val >> 16) { prc += 16; val = val >> 16; }
     if (val >> 8) { prc += 8; val = val >> 8; }
     if (val >> 4) { prc += 4; val = val >> 4; }
     if (val >> 2) { prc += 2; val = val >> 2; }
-    if (val >> 1) { prc++; }
+    if (val >> 1) { prc++; val = val >> 1; }
+    return prc + (int)val;
+#endif
+}
+/// MPINHO 17-oct-2026 END ///
 
-    return prc;
+int
+unsignedIntResolution(uint64_t val)
+{
+    return msbPosition(val); /// MPINHO 17-oct-2026 ///
 }
 
 int
@@ -26,21 +43,8 @@ signedIntResolution(uint64_t val)
     // the precision of a value is equal to its complement's
     if (val >> 63) val = ~val;
 
-    int prc = 1;
-
-    // fast result
-    if (!val) return prc;
-
     // find the most significative 1 bit and add one
-    prc++;
-    if (val >> 32) { prc += 32; val = val >> 32; }
-    if (val >> 16) { prc += 16; val = val >> 16; }
-    if (val >> 8) { prc += 8; val = val >> 8; }
-    if (val >> 4) { prc += 4; val = val >> 4; }
-    if (val >> 2) { prc += 2; val = val >> 2; }
-    if (val >> 1) { prc++; }
-
-    return prc;
+    return msbPosition(val) + 1; /// MPINHO 17-oct-2026 ///
 }
 
 /// MPINHO 15-may-2019 BEGIN ///
@@ -60,4 +64,66 @@ roundPrcBlock(int prc, int block)
 
 /// MPINHO 15-may-2019 END ///
 
+/// MPINHO 17-oct-2026 BEGIN ///
+/**
+ * Lane resolution kernel for a given lane type. The loop has no calls nor
+ * data dependent branches, so the compiler can unroll and vectorize it.
+ */
+template <typename Lane>
+static void
+laneIntResolutionKernel(const void *data, int num_lanes, bool is_signed,
+                        int block, uint8_t *res)
+{
+    typedef typename std::make_signed<Lane>::type SignedLane;
+    const int lane_bits = sizeof(Lane) * 8;
+
+    for (int i = 0; i < num_lanes; i++) {
+        Lane lane;
+        std::memcpy(&lane, (const uint8_t *)data + i * sizeof(Lane),
+                    sizeof(Lane));
+
+        int prc;
+        if (is_signed) {
+            // Complement the negative lanes, as in signedIntResolution.
+            Lane sign = (Lane)((SignedLane)lane >> (lane_bits - 1));
+            prc = msbPosition((uint64_t)(Lane)(lane ^ sign)) + 1;
+        } else {
+            prc = msbPosition((uint64_t)lane);
+        }
+
+        // The block may be larger than the lane.
+        prc = (prc + block - 1) & -block;
+        res[i] = prc < lane_bits ? prc : lane_bits;
+    }
+}
+
+void
+laneIntResolution(const void *data, int num_lanes, int lane_bytes,
+                  bool is_signed, int block, uint8_t *res)
+{
+    assert(block && ((block & (block-1)) == 0));
+
+    switch (lane_bytes) {
+      case 1:
+        laneIntResolutionKernel<uint8_t>(data, num_lanes, is_signed, block,
+                                         res);
+        break;
+      case 2:
+        laneIntResolutionKernel<uint16_t>(data, num_lanes, is_signed, block,
+                                          res);
+        break;
+      case 4:
+        laneIntResolutionKernel<uint32_t>(data, num_lanes, is_signed, block,
+                                          res);
+        break;
+      case 8:
+        laneIntResolutionKernel<uint64_t>(data, num_lanes, is_signed, block,
+                                          res);
+        break;
+      default:
+        panic("Invalid lane size: %d bytes.", lane_bytes);
+    }
+}
+/// MPINHO 17-oct-2026 END ///
+
 /// MPINHO 2-mar-2019 END ///
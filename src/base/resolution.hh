@@ -52,5 +52,24 @@ int roundPrcBlock(int prc, int block);
  */
 int roundPrcBlockLog(int prc, int block);
 
+/// MPINHO 17-oct-2026 BEGIN ///
+/**
+ * Returns the resolution, in bits, of each lane of a vector of packed
+ * integer lanes, rounded up to a given block size. Each lane is taken as a
+ * value of its own size, so a negative lane has at most the lane size in
+ * signed and unsigned resolution.
+ *
+ * @param data pointer to the packed lanes, in host byte order
+ * @param num_lanes number of lanes
+ * @param lane_bytes size of each lane in bytes (1, 2, 4 or 8)
+ * @param is_signed use the signed resolution, otherwise the unsigned one
+ * @param block size of the blocks in bit, which must be a power of two
+ * @param res output array, with the resolution of each lane (up to the
+ *            lane size, in bits)
+ */
+void laneIntResolution(const void *data, int num_lanes, int lane_bytes,
+                       bool is_signed, int block, uint8_t *res);
+/// MPINHO 17-oct-2026 END ///
+
 #endif // __BASE_RESOLUTION_HH__
 /// MPINHO 2-mar-2019 END ///
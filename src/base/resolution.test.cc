@@ -0,0 +1,84 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include "base/resolution.hh"
+
+TEST(ResolutionTest, UnsignedIntResolution)
+{
+    EXPECT_EQ(0, unsignedIntResolution(0));
+    EXPECT_EQ(1, unsignedIntResolution(1));
+    EXPECT_EQ(8, unsignedIntResolution(0xff));
+    EXPECT_EQ(9, unsignedIntResolution(0x100));
+    EXPECT_EQ(33, unsignedIntResolution(0x100000000ULL));
+    EXPECT_EQ(48, unsignedIntResolution(0x0000ffff00000000ULL));
+    EXPECT_EQ(64, unsignedIntResolution(~0ULL));
+}
+
+TEST(ResolutionTest, SignedIntResolution)
+{
+    EXPECT_EQ(1, signedIntResolution(0));
+    EXPECT_EQ(1, signedIntResolution(~0ULL));
+    EXPECT_EQ(2, signedIntResolution(1));
+    EXPECT_EQ(8, signedIntResolution(127));
+    EXPECT_EQ(9, signedIntResolution(128));
+    EXPECT_EQ(8, signedIntResolution((uint64_t)-128));
+    EXPECT_EQ(34, signedIntResolution(0x100000000ULL));
+    EXPECT_EQ(64, signedIntResolution(0x8000000000000000ULL));
+}
+
+TEST(ResolutionTest, LaneMatchesScalar)
+{
+    const std::array<int64_t, 6> vals = {
+        0, 1, -1, 127, -129, 0x12345678
+    };
+    const int blocks[] = {1, 8};
+
+    for (int block : blocks) {
+        std::array<uint8_t, 6> res;
+        laneIntResolution(vals.data(), vals.size(), 8, true, block,
+                          res.data());
+        for (int i = 0; i < vals.size(); i++) {
+            EXPECT_EQ(roundPrcBlock(signedIntResolution(vals[i]), block),
+                      res[i]);
+        }
+        laneIntResolution(vals.data(), vals.size(), 8, false, block,
+                          res.data());
+        for (int i = 0; i < vals.size(); i++) {
+            EXPECT_EQ(roundPrcBlock(unsignedIntResolution(vals[i]), block),
+                      res[i]);
+        }
+    }
+}
+
+TEST(ResolutionTest, LaneSize)
+{
+    // Negative lanes are as wide as the lane, at most.
+    const std::array<int8_t, 4> bytes = {0, -1, 0x7f, -0x80};
+    std::array<uint8_t, 4> res;
+
+    laneIntResolution(bytes.data(), bytes.size(), 1, true, 1, res.data());
+    EXPECT_EQ(1, res[0]);
+    EXPECT_EQ(1, res[1]);
+    EXPECT_EQ(8, res[2]);
+    EXPECT_EQ(8, res[3]);
+
+    laneIntResolution(bytes.data(), bytes.size(), 1, false, 1, res.data());
+    EXPECT_EQ(0, res[0]);
+    EXPECT_EQ(8, res[1]);
+    EXPECT_EQ(7, res[2]);
+    EXPECT_EQ(8, res[3]);
+
+    // Blocks larger than the lane are clamped to the lane size.
+    const std::array<int16_t, 2> halves = {1, -0x100};
+    std::array<uint8_t, 2> hres;
+    laneIntResolution(halves.data(), halves.size(), 2, true, 32,
+                      hres.data());
+    EXPECT_EQ(16, hres[0]);
+    EXPECT_EQ(16, hres[1]);
+}
+
+/// MPINHO 17-oct-2026 END ///
@@ -56,6 +56,26 @@ class OpClass(Enum):
             'FloatMemRead', 'FloatMemWrite',
             'IprAccess', 'InstPrefetch']
 
+### MPINHO 07-may-2019 BEGIN ###
+class WidthDefinition(ScopedEnum):
+    vals = [ 'Signed', 'Unsigned' ]
+
+class WidthPackingPolicy(ScopedEnum):
+    vals = [ 'Disabled', 'Simple', 'Optimal', 'MultiElement' ]
+### MPINHO 07-may-2019 END ###
+
+### MPINHO 26-jul-2019 BEGIN ###
+class WidthClass(ScopedEnum):
+    vals = [ 'NoInfo', 'SimdNoInfo', 'SimdNoPacking', 'SimdPackingAlu',
+             'SimdPackingMult',
+             'IntPackingAlu', 'IntPackingMult' ] ### MPINHO 17-oct-2026
+### MPINHO 26-jul-2019 END ###
+
+### MPINHO 30-jul-2019 BEGIN ###
+class VecElemSize(ScopedEnum):
+    vals = [ 'Unknown', 'Bit8', 'Bit16', 'Bit32', 'Bit64' ]
+### MPINHO 30-jul-2019 END ###
+
 class OpDesc(SimObject):
     type = 'OpDesc'
     cxx_header = "cpu/func_unit.hh"
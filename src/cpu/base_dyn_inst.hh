@@ -93,7 +93,9 @@ class BaseDynInst : public ExecContext, public RefCounted
     typedef RefCountingPtr<BaseDynInst<Impl> > BaseDynInstPtr;
 
     // The list of instructions iterator type.
-    typedef typename std::list<DynInstPtr>::iterator ListIt;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    typedef typename Impl::DynInstList::iterator ListIt;
+    /// MPINHO 17-oct-2026 END ///
 
     enum {
         MaxInstSrcRegs = TheISA::MaxInstSrcRegs,        /// Max source regs
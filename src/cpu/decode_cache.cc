@@ -0,0 +1,12 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+
+#include "cpu/decode_cache.hh"
+
+namespace DecodeCache
+{
+
+Counts counts;
+
+} // namespace DecodeCache
+
+/// MPINHO 17-oct-2026 END ///
@@ -32,9 +32,15 @@
 #define __CPU_DECODE_CACHE_HH__
 
 #include <unordered_map>
+/// MPINHO 17-oct-2026 BEGIN ///
+#include <functional>
+#include <utility>
+#include <vector>
+/// MPINHO 17-oct-2026 END ///
 
 #include "arch/isa_traits.hh"
 #include "arch/types.hh"
+#include "base/types.hh" /// MPINHO 17-oct-2026 ///
 #include "config/the_isa.hh"
 #include "cpu/static_inst_fwd.hh"
 
@@ -46,9 +52,118 @@ namespace TheISA
 namespace DecodeCache
 {
 
-/// Hash for decoded instructions.
+/// MPINHO 17-oct-2026 BEGIN ///
+/// Lookups in all the decode caches of the simulator, which are shared by
+/// every CPU using the same decoder. Reported as global statistics.
+struct Counts
+{
+    /// Address lookups that found their page in a page table.
+    Counter pageHits;
+    /// Address lookups that had to search the map of pages.
+    Counter pageMisses;
+    /// Decodes of the instruction last decoded at the same address.
+    Counter addrHits;
+    /// Decodes found in an instruction map.
+    Counter instHits;
+    /// Decodes of instructions that were not in an instruction map.
+    Counter instMisses;
+};
+
+extern Counts counts;
+
+/// Hash for decoded instructions, with open addressing and linear probing.
+/// It offers the part of the std::unordered_map interface the decoders
+/// use, and an iterator is a pointer to the stored (EMI, StaticInstPtr)
+/// pair. Instructions are never removed.
 template <typename EMI>
-using InstMap = std::unordered_map<EMI, StaticInstPtr>;
+class InstMap
+{
+  public:
+    typedef std::pair<EMI, StaticInstPtr> value_type;
+    typedef value_type *iterator;
+
+  private:
+    struct Slot
+    {
+        bool used;
+        value_type entry;
+
+        Slot() : used(false) {}
+    };
+
+    std::vector<Slot> slots;
+    /// Log2 of the number of slots.
+    unsigned bits;
+    size_t numUsed;
+
+    /// The slot holding emi, or the empty slot where it would go.
+    Slot &
+    probe(const EMI &emi)
+    {
+        // Fibonacci hashing spreads the key over the table, as std::hash
+        // is often the identity.
+        uint64_t hash = std::hash<EMI>()(emi);
+        size_t idx = (hash * ULL(0x9e3779b97f4a7c15)) >> (64 - bits);
+        size_t mask = slots.size() - 1;
+
+        while (slots[idx].used && !(slots[idx].entry.first == emi))
+            idx = (idx + 1) & mask;
+
+        return slots[idx];
+    }
+
+    /// Doubles the number of slots, keeping the load factor under 1/2.
+    void
+    grow()
+    {
+        std::vector<Slot> old_slots(size_t(1) << ++bits);
+        old_slots.swap(slots);
+
+        for (auto &slot : old_slots) {
+            if (slot.used) {
+                Slot &new_slot = probe(slot.entry.first);
+                new_slot.used = true;
+                new_slot.entry = std::move(slot.entry);
+            }
+        }
+    }
+
+  public:
+    InstMap() : slots(size_t(1) << 10), bits(10), numUsed(0) {}
+
+    iterator end() { return nullptr; }
+
+    iterator
+    find(const EMI &emi)
+    {
+        Slot &slot = probe(emi);
+        if (!slot.used) {
+            counts.instMisses++;
+            return end();
+        }
+
+        counts.instHits++;
+        return &slot.entry;
+    }
+
+    StaticInstPtr &
+    operator[](const EMI &emi)
+    {
+        Slot *slot = &probe(emi);
+        if (!slot->used) {
+            if (2 * (numUsed + 1) > slots.size()) {
+                grow();
+                slot = &probe(emi);
+            }
+            slot->used = true;
+            slot->entry.first = emi;
+            numUsed++;
+        }
+
+        return slot->entry.second;
+    }
+};
+/// MPINHO 17-oct-2026 END ///
 
 /// A sparse map from an Addr to a Value, stored in page chunks.
 template<class Value>
@@ -61,61 +176,60 @@ class AddrMap
     };
     // A map of cache pages which allows a sparse mapping.
     typedef typename std::unordered_map<Addr, CachePage *> PageMap;
-    typedef typename PageMap::iterator PageIt;
-    // Mini cache of recent lookups.
-    PageIt recent[2];
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // Number of entries of the page table, a power of 2.
+    static const size_t TableSize = 1024;
+    struct TableEntry {
+        Addr pageAddr;
+        CachePage *page;
+    };
+    // Page table in front of the map, direct mapped by page number. The
+    // map owns the pages, an entry just points to the last page looked up
+    // with its index.
+    TableEntry table[TableSize];
+    /// MPINHO 17-oct-2026 END ///
     PageMap pageMap;
 
-    /// Update the mini cache of recent lookups.
-    /// @param recentest The most recent result;
-    void
-    update(PageIt recentest)
-    {
-        recent[1] = recent[0];
-        recent[0] = recentest;
-    }
-
-    /// Attempt to find the CacheePage which goes with a particular
-    /// address. First check the small cache of recent results, then
-    /// actually look in the hash map.
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /// Attempt to find the CachePage which goes with a particular
+    /// address. First check the page table, then actually look in the
+    /// hash map.
     /// @param addr The address to look up.
     CachePage *
     getPage(Addr addr)
     {
         Addr page_addr = addr & ~(TheISA::PageBytes - 1);
+        TableEntry &entry =
+            table[(page_addr / TheISA::PageBytes) & (TableSize - 1)];
 
-        // Check against recent lookups.
-        if (recent[0] != pageMap.end()) {
-            if (recent[0]->first == page_addr)
-                return recent[0]->second;
-            if (recent[1] != pageMap.end() &&
-                    recent[1]->first == page_addr) {
-                update(recent[1]);
-                // recent[1] has just become recent[0].
-                return recent[0]->second;
-            }
+        if (entry.page && entry.pageAddr == page_addr) {
+            counts.pageHits++;
+            return entry.page;
         }
 
-        // Actually look in the has_map.
-        PageIt it = pageMap.find(page_addr);
-        if (it != pageMap.end()) {
-            update(it);
-            return it->second;
-        }
+        counts.pageMisses++;
 
-        // Didn't find an existing page, so add a new one.
-        CachePage *newPage = new CachePage;
-        page_addr = page_addr & ~(TheISA::PageBytes - 1);
-        typename PageMap::value_type to_insert(page_addr, newPage);
-        update(pageMap.insert(to_insert).first);
-        return newPage;
+        // Add a new page if there is none for this address yet.
+        CachePage *&page = pageMap[page_addr];
+        if (!page)
+            page = new CachePage;
+
+        entry.pageAddr = page_addr;
+        entry.page = page;
+        return page;
     }
+    /// MPINHO 17-oct-2026 END ///
 
   public:
     /// Constructor
     AddrMap()
     {
-        recent[0] = recent[1] = pageMap.end();
+        /// MPINHO 17-oct-2026 BEGIN ///
+        for (auto &entry : table) {
+            entry.pageAddr = 0;
+            entry.page = nullptr;
+        }
+        /// MPINHO 17-oct-2026 END ///
     }
 
     Value &
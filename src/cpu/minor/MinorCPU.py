@@ -52,6 +52,9 @@ from m5.objects.BranchPredictor import *
 from m5.objects.TimingExpr import TimingExpr
 
 from m5.objects.FuncUnit import OpClass
+### MPINHO 17-oct-2026 BEGIN ###
+from m5.objects.FuncUnit import WidthDefinition, WidthPackingPolicy
+### MPINHO 17-oct-2026 END ###
 
 class MinorOpClass(SimObject):
     """Boxing of OpClass to get around build problems and provide a hook for
@@ -119,6 +122,14 @@ class MinorFU(SimObject):
         "list of FU indices from which this FU can't receive and early"
         " (forwarded) result")
 
+    ### MPINHO 17-oct-2026 BEGIN ###
+    fuseCap = Param.Unsigned(0, "number of extra instructions that can be"
+        " packed into the slot of an instruction issued to this FU, if"
+        " their width and type match")
+    widthCap = Param.Unsigned(64, "width this FU has available for packed"
+        " instructions")
+    ### MPINHO 17-oct-2026 END ###
+
 class MinorFUPool(SimObject):
     type = 'MinorFUPool'
     cxx_header = "cpu/minor/func_unit.hh"
@@ -156,6 +167,10 @@ class MinorDefaultFloatSimdFU(MinorFU):
     timings = [MinorFUTiming(description='FloatSimd',
         srcRegsRelativeLats=[2])]
     opLat = 6
+    ### MPINHO 17-oct-2026 BEGIN ###
+    fuseCap = 1
+    widthCap = 128
+    ### MPINHO 17-oct-2026 END ###
 
 class MinorDefaultMemFU(MinorFU):
     opClasses = minorMakeOpClassSet(['MemRead', 'MemWrite', 'FloatMemRead',
@@ -275,6 +290,15 @@ class MinorCPU(BaseCPU):
     enableIdling = Param.Bool(True,
         "Enable cycle skipping when the processor is idle\n");
 
+    ### MPINHO 17-oct-2026 BEGIN ###
+    # width config parameters, as in DerivO3CPU
+    widthDefinition = Param.WidthDefinition('Signed',
+        "Width definition to use")
+    widthBlockSize = Param.Unsigned(8, "Width block size in bits")
+    widthPackingPolicy = Param.WidthPackingPolicy('Disabled',
+        "Policy on valid packing requirements")
+    ### MPINHO 17-oct-2026 END ###
+
     branchPred = Param.BranchPredictor(TournamentBP(
         numThreads = Parent.numThreads), "Branch Predictor")
 
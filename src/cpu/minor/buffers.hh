@@ -363,8 +363,7 @@ class SelfStallingPipeline : public MinorBuffer<ElemType, ReportTraits>
             /* Insert a bubble into the empty input slot to make sure that
              *  element is correct in the case where the default constructor
              *  for ElemType doesn't produce a bubble */
-            ElemType bubble = BubbleTraits::bubble();
-            *pushWire = bubble;
+            *pushWire = BubbleTraits::bubble(); /// MPINHO 17-oct-2026 ///
         }
     }
 };
@@ -148,7 +148,12 @@ Decode::evaluate()
            decode_info.inputIndex < insts_in->width() && /* Still more input */
            output_index < outputWidth /* Still more output to fill */)
         {
-            MinorDynInstPtr inst = insts_in->insts[decode_info.inputIndex];
+            /// MPINHO 17-oct-2026 BEGIN ///
+            /* Read in place, insts_in stays in the input buffer until popped
+             *  below */
+            const MinorDynInstPtr &inst =
+                insts_in->insts[decode_info.inputIndex];
+            /// MPINHO 17-oct-2026 END ///
 
             if (inst->isBubble()) {
                 /* Skip */
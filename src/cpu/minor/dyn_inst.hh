@@ -50,11 +50,13 @@
 
 #include <iostream>
 
+#include "base/pool_alloc.hh" /// MPINHO 17-oct-2026 ///
 #include "base/refcnt.hh"
 #include "cpu/minor/buffers.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/static_inst.hh"
 #include "cpu/timing_expr.hh"
+#include "cpu/width_info.hh" /// MPINHO 17-oct-2026 ///
 #include "sim/faults.hh"
 
 namespace Minor
@@ -221,6 +223,18 @@ class MinorDynInst : public RefCounted
      *  up */
     RegId flatDestRegIdx[TheISA::MaxInstDestRegs];
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Width information, classified when the instruction can issue */
+    WidthInfo width;
+
+    /** The width has already been classified */
+    bool widthDecoded;
+
+    /** This instruction was packed into the FU slot of another one
+     *  issued in the same cycle, and does not occupy the FU pipeline */
+    bool packed;
+    /// MPINHO 17-oct-2026 END ///
+
   public:
     MinorDynInst(InstId id_ = InstId(), Fault fault_ = NoFault) :
         staticInst(NULL), id(id_), traceData(NULL),
@@ -229,15 +243,44 @@ class MinorDynInst : public RefCounted
         fuIndex(0), inLSQ(false), inStoreBuffer(false),
         canEarlyIssue(false),
         instToWaitFor(0), extraCommitDelay(Cycles(0)),
-        extraCommitDelayExpr(NULL), minimumCommitCycle(Cycles(0))
+        extraCommitDelayExpr(NULL), minimumCommitCycle(Cycles(0)),
+        widthDecoded(false), packed(false) /// MPINHO 17-oct-2026 ///
     { }
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Instructions are recycled through a block pool, as Fetch2 and
+     *  Decode create one for every fetched instruction and micro-op and
+     *  the last reference is dropped soon after commit */
+    static void *
+    operator new(size_t size)
+    {
+        static_assert(alignof(MinorDynInst) <= alignof(std::max_align_t),
+                      "Pool blocks are not aligned for MinorDynInst");
+        if (size != sizeof(MinorDynInst))
+            return ::operator new(size);
+        return BlockPool<sizeof(MinorDynInst)>::allocate();
+    }
+
+    static void
+    operator delete(void *ptr, size_t size)
+    {
+        if (size != sizeof(MinorDynInst))
+            ::operator delete(ptr);
+        else
+            BlockPool<sizeof(MinorDynInst)>::release(ptr);
+    }
+    /// MPINHO 17-oct-2026 END ///
+
   public:
     /** The BubbleIF interface. */
     bool isBubble() const { return id.fetchSeqNum == 0; }
 
     /** There is a single bubble inst */
-    static MinorDynInstPtr bubble() { return bubbleInst; }
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /* Returned by reference, so that filling a slot with a bubble does not
+     *  go through a temporary pointer and its reference counting */
+    static const MinorDynInstPtr &bubble() { return bubbleInst; }
+    /// MPINHO 17-oct-2026 END ///
 
     /** Is this a fault rather than instruction */
     bool isFault() const { return fault != NoFault; }
@@ -47,6 +47,7 @@
 #include "cpu/minor/fetch1.hh"
 #include "cpu/minor/lsq.hh"
 #include "cpu/op_class.hh"
+#include "cpu/width_decoder_impl.hh" /// MPINHO 17-oct-2026 ///
 #include "debug/Activity.hh"
 #include "debug/Branch.hh"
 #include "debug/Drain.hh"
@@ -136,7 +137,11 @@ Execute::Execute(const std::string &name_,
         /* Note the total number of instruction slots (for sizing
          *  the inFlightInst queue) and the maximum latency of any FU
          *  (for sizing the activity recorder) */
-        total_slots += fu_description->opLat;
+        /// MPINHO 17-oct-2026 BEGIN ///
+        /* Each slot can also carry the instructions packed into it */
+        total_slots += fu_description->opLat *
+            (fu_description->fuseCap + 1);
+        /// MPINHO 17-oct-2026 END ///
 
         fu_name << name_ << ".fu." << i;
 
@@ -166,6 +171,12 @@ Execute::Execute(const std::string &name_,
         }
     }
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    widthDecoder.init(name_, params.widthDefinition, params.widthBlockSize,
+        params.widthPackingPolicy);
+    widthDecoder.setCPU(&cpu_);
+    /// MPINHO 17-oct-2026 END ///
+
     /* Per-thread structures */
     for (ThreadID tid = 0; tid < params.numThreads; tid++) {
         std::string tid_str = std::to_string(tid);
@@ -558,7 +569,8 @@ Execute::issue(ThreadID thread_id)
     unsigned num_insts_discarded = 0;
 
     do {
-        MinorDynInstPtr inst = insts_in->insts[thread.inputIndex];
+        const MinorDynInstPtr &inst = /// MPINHO 17-oct-2026 ///
+            insts_in->insts[thread.inputIndex];
         Fault fault = inst->fault;
         bool discarded = false;
         bool issued_mem_ref = false;
@@ -628,6 +640,14 @@ Execute::issue(ThreadID thread_id)
 
                     issued = true;
 
+                /// MPINHO 17-oct-2026 BEGIN ///
+                } else if (fu_is_capable && fu->alreadyPushed() &&
+                    tryToPack(inst, fu_index, thread_id))
+                {
+                    /* Packed into the slot of the inst already issued to
+                     *  this FU */
+                    issued = true;
+                /// MPINHO 17-oct-2026 END ///
                 } else if (!fu_is_capable || fu->alreadyPushed()) {
                     /* Skip */
                     if (!fu_is_capable) {
@@ -735,6 +755,12 @@ Execute::issue(ThreadID thread_id)
 
                         /* Issue to FU */
                         fu->push(fu_inst);
+
+                        /// MPINHO 17-oct-2026 BEGIN ///
+                        if (!issued_mem_ref && !inst->isFault())
+                            openPacking(inst, fu, thread_id);
+                        /// MPINHO 17-oct-2026 END ///
+
                         /* And start the countdown on activity to allow
                          *  this instruction to get to the end of its FU */
                         cpu.activityRecorder->activity();
@@ -820,6 +846,155 @@ Execute::issue(ThreadID thread_id)
     return num_insts_issued;
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+void
+Execute::decodeWidth(MinorDynInstPtr inst, ThreadID thread_id)
+{
+    if (inst->widthDecoded)
+        return;
+
+    inst->widthDecoded = true;
+
+    /* Forwarded values are not in the register file yet, so the width
+     *  of the inst is left unknown and it is not packed */
+    if (scoreboard[thread_id].hasInFlightSrcs(inst,
+        cpu.getContext(thread_id)))
+    {
+        DPRINTF(MinorExecute, "Not classifying width of inst: %s as some"
+            " source is still in flight\n", *inst);
+
+        widthInFlightSrcs++;
+        return;
+    }
+
+    WidthInst width_inst(inst, *cpu.threads[thread_id]);
+    widthDecoder.addWidthInfo(&width_inst);
+}
+
+void
+Execute::openPacking(MinorDynInstPtr inst, FUPipeline *fu,
+    ThreadID thread_id)
+{
+    decodeWidth(inst, thread_id);
+
+    WidthInst width_inst(inst, *cpu.threads[thread_id]);
+    int width_val = width_inst.getWidthVal();
+
+    issuedWidthClass[static_cast<int>(width_inst.getWidthClass())]++;
+
+    /* Only pipelined FUs with room for more insts in this slot can take
+     *  packed insts */
+    if (widthDecoder.isFuseType(&width_inst) &&
+        fu->description.issueLat == Cycles(1) &&
+        fu->getIssueCap() > 1 &&
+        width_val <= fu->getWidthCap())
+    {
+        fu->useIssueCap();
+        fu->useWidthCap(width_val);
+        widthDecoder.packInst(fu->packing, &width_inst);
+        fu->packHead = inst;
+
+        DPRINTF(MinorExecute, "Inst: %s of width %d can be packed with,"
+            " FU issueCap: %d widthCap: %d\n", *inst, width_val,
+            fu->getIssueCap(), fu->getWidthCap());
+    }
+}
+
+bool
+Execute::tryToPack(MinorDynInstPtr inst, unsigned int fu_index,
+    ThreadID thread_id)
+{
+    FUPipeline *fu = funcUnits[fu_index];
+
+    if (fu->packHead->isBubble() || inst->isFault() || inst->isMemRef() ||
+        fu->getIssueCap() == 0)
+    {
+        return false;
+    }
+
+    MinorFUTiming *timing = fu->findTiming(inst->staticInst);
+
+    const std::vector<Cycles> *src_latencies =
+        (timing ? &(timing->srcRegsRelativeLats) : NULL);
+
+    if ((timing && timing->suppress) ||
+        !scoreboard[thread_id].canInstIssue(inst, src_latencies,
+            &(fu->cantForwardFromFUIndices), cpu.curCycle(),
+            cpu.getContext(thread_id)))
+    {
+        return false;
+    }
+
+    decodeWidth(inst, thread_id);
+
+    MinorThread &thread = *cpu.threads[thread_id];
+    WidthInst width_inst(inst, thread);
+    WidthInst head_inst(fu->packHead, thread);
+
+    if (!widthDecoder.matchFuseType(&head_inst, &width_inst))
+        return false;
+
+    int width_class = static_cast<int>(width_inst.getWidthClass());
+    int width_val = width_inst.getWidthVal();
+
+    fuseChances[width_class]++;
+
+    if (width_val > fu->getWidthCap() ||
+        !widthDecoder.canPackInst(fu->packing, &width_inst))
+    {
+        DPRINTF(MinorExecute, "Can't pack inst: %s with inst: %s in FU:"
+            " %d, widths don't match\n", *inst, *(fu->packHead),
+            fu_index);
+
+        fuseFailNoMatch[width_class]++;
+        return false;
+    }
+
+    DPRINTF(MinorExecute, "Packing inst: %s with inst: %s in FU: %d\n",
+        *inst, *(fu->packHead), fu_index);
+
+    fuseSuccess[width_class]++;
+    if (widthDecoder.isMultiElementFuse(fu->packing, &width_inst))
+        fuseMultiElement[width_class]++;
+    issuedWidthClass[width_class]++;
+
+    widthDecoder.packInst(fu->packing, &width_inst);
+    fu->useIssueCap();
+    fu->useWidthCap(width_val);
+
+    Cycles extra_dest_retire_lat = Cycles(0);
+    TimingExpr *extra_dest_retire_lat_expr = NULL;
+    Cycles extra_assumed_lat = Cycles(0);
+
+    if (timing) {
+        extra_dest_retire_lat = timing->extraCommitLat;
+        extra_dest_retire_lat_expr = timing->extraCommitLatExpr;
+        extra_assumed_lat = timing->extraAssumedLat;
+    }
+
+    /* Decorate the inst with FU details.  It shares the slot of the
+     *  packing head, so leaves the FU at the same time */
+    inst->fuIndex = fu_index;
+    inst->packed = true;
+    inst->extraCommitDelay = extra_dest_retire_lat;
+    inst->extraCommitDelayExpr = extra_dest_retire_lat_expr;
+
+    cpu.activityRecorder->activity();
+
+    /* Mark the destinations for this instruction as busy */
+    scoreboard[thread_id].markupInstDests(inst, cpu.curCycle() +
+        fu->description.opLat + extra_dest_retire_lat + extra_assumed_lat,
+        cpu.getContext(thread_id), false);
+
+    /* Push the instruction onto the inFlight queue so it can be
+     *  committed in order */
+    QueuedInst fu_inst(inst);
+    executeInfo[thread_id].inFlightInsts->push(fu_inst);
+
+    return true;
+}
+/// MPINHO 17-oct-2026 END ///
+
 bool
 Execute::tryPCEvents(ThreadID thread_id)
 {
@@ -1185,6 +1360,18 @@ Execute::commit(ThreadID thread_id, bool only_commit_microops, bool discard,
                 completed_inst = true;
             }
 
+            /// MPINHO 17-oct-2026 BEGIN ///
+            /* Packed insts left their FU along with the inst whose slot
+             *  they shared, which is older and so already completed */
+            if (!completed_inst && inst->packed) {
+                DPRINTF(MinorExecute, "Committing packed inst: %s\n",
+                    *inst);
+
+                try_to_commit = true;
+                completed_inst = true;
+            }
+            /// MPINHO 17-oct-2026 END ///
+
             /* Try to issue from the ends of FUs and the inFlightInsts
              *  queue */
             if (!completed_inst && !inst->inLSQ) {
@@ -1290,7 +1477,8 @@ Execute::commit(ThreadID thread_id, bool only_commit_microops, bool discard,
                      *  instruction wasn't the inFlightInsts head
                      *  but had already been committed, it would have
                      *  unstalled the pipeline before here */
-                    if (inst->fuIndex != noCostFUIndex) {
+                    /// MPINHO 17-oct-2026 ///
+                    if (inst->fuIndex != noCostFUIndex && !inst->packed) {
                         DPRINTF(MinorExecute, "Unstalling %d for inst %s\n", inst->fuIndex, inst->id);
                         funcUnits[inst->fuIndex]->stalled = false;
                     }
@@ -1491,7 +1679,10 @@ Execute::evaluate()
            be issued */
         if (getInput(tid)) {
             unsigned int input_index = executeInfo[tid].inputIndex;
-            MinorDynInstPtr inst = getInput(tid)->insts[input_index];
+            /// MPINHO 17-oct-2026 BEGIN ///
+            const MinorDynInstPtr &inst =
+                getInput(tid)->insts[input_index];
+            /// MPINHO 17-oct-2026 END ///
             if (inst->isFault()) {
                 can_issue_next = true;
             } else if (!inst->isBubble()) {
@@ -1535,7 +1726,8 @@ Execute::evaluate()
         if (!info.inFlightInsts->empty()) {
             const QueuedInst &head_inst = info.inFlightInsts->front();
 
-            if (head_inst.inst->isNoCostInst()) {
+            /// MPINHO 17-oct-2026 ///
+            if (head_inst.inst->isNoCostInst() || head_inst.inst->packed) {
                 head_inst_might_commit = true;
             } else {
                 FUPipeline *fu = funcUnits[head_inst.inst->fuIndex];
@@ -1630,6 +1822,73 @@ Execute::hasInterrupt(ThreadID thread_id)
     return false;
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+void
+Execute::regStats()
+{
+    using namespace Stats;
+
+    widthDecoder.regStats();
+
+    issuedWidthClass
+        .init(static_cast<int>(WidthClass::Num_WidthClass))
+        .name(name() + ".widthClass")
+        .desc("Width class of insts issued to FUs")
+        .flags(total | pdf | dist)
+        ;
+    for (int i = 0; i < static_cast<int>(WidthClass::Num_WidthClass); i++)
+        issuedWidthClass.subname(i, WidthClassStrings[i]);
+
+    widthInFlightSrcs
+        .name(name() + ".widthInFlightSrcs")
+        .desc("Number of insts left without width information as some"
+              " source was still in flight")
+        ;
+
+    fuseChances
+        .init(static_cast<int>(WidthClass::Num_WidthClass))
+        .name(name() + ".fuseChances")
+        .desc("Number of second instructions found for fuse")
+        .flags(total)
+        ;
+
+    fuseFailNoMatch
+        .init(static_cast<int>(WidthClass::Num_WidthClass))
+        .name(name() + ".fuseFailNoMatch")
+        .desc("Number of fuse fails due to width mismatch")
+        .flags(total)
+        ;
+
+    fuseSuccess
+        .init(static_cast<int>(WidthClass::Num_WidthClass))
+        .name(name() + ".fuseSuccess")
+        .desc("Number of fuse successes")
+        .flags(total)
+        ;
+    fuseSuccessNorm
+        .name(name() + ".fuseSuccessNorm")
+        .desc("Fraction of fuse successes,"
+              " over instructions issued of that class")
+        ;
+    fuseSuccessNorm = fuseSuccess / issuedWidthClass;
+
+    fuseMultiElement
+        .init(static_cast<int>(WidthClass::Num_WidthClass))
+        .name(name() + ".fuseMultiElement")
+        .desc("Number of fuse successes that required multi-element"
+              " packing")
+        .flags(total)
+        ;
+
+    for (int i = 0; i < static_cast<int>(WidthClass::Num_WidthClass); i++) {
+        fuseChances.subname(i, WidthClassStrings[i]);
+        fuseFailNoMatch.subname(i, WidthClassStrings[i]);
+        fuseSuccess.subname(i, WidthClassStrings[i]);
+        fuseMultiElement.subname(i, WidthClassStrings[i]);
+    }
+}
+/// MPINHO 17-oct-2026 END ///
+
 void
 Execute::minorTrace() const
 {
@@ -1711,10 +1970,13 @@ Execute::getCommittingThread()
                          inst->id.execSeqNum > fu_inst->instToWaitFor;
                 }
 
-                bool can_execute_fu_inst = inst->fuIndex == noCostFUIndex;
+                /// MPINHO 17-oct-2026 BEGIN ///
+                bool can_execute_fu_inst = inst->fuIndex == noCostFUIndex ||
+                    inst->packed;
                 if (can_commit_insts && !can_transfer_mem_inst &&
-                        inst->fuIndex != noCostFUIndex)
+                        inst->fuIndex != noCostFUIndex && !inst->packed)
                 {
+                /// MPINHO 17-oct-2026 END ///
                     QueuedInst& fu_inst = funcUnits[inst->fuIndex]->front();
                     can_execute_fu_inst = !fu_inst.inst->isBubble() &&
                         fu_inst.inst->id == inst->id;
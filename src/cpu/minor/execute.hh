@@ -53,6 +53,10 @@
 #include "cpu/minor/lsq.hh"
 #include "cpu/minor/pipe_data.hh"
 #include "cpu/minor/scoreboard.hh"
+/// MPINHO 17-oct-2026 BEGIN ///
+#include "cpu/minor/width_inst.hh"
+#include "cpu/width_decoder.hh"
+/// MPINHO 17-oct-2026 END ///
 
 namespace Minor
 {
@@ -121,6 +125,33 @@ class Execute : public Named
     /** The execution functional units */
     std::vector<FUPipeline *> funcUnits;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Width classification of the instructions issued, shared with O3 */
+    WidthDecoder<WidthImpl> widthDecoder;
+
+    /** Width class of the insts issued to FUs */
+    Stats::Vector issuedWidthClass;
+
+    /** Insts left without width information as some source was still
+     *  in flight */
+    Stats::Scalar widthInFlightSrcs;
+
+    /** Insts found of a matching type for packing, by width class */
+    Stats::Vector fuseChances;
+
+    /** Packing fails due to width mismatch, by width class */
+    Stats::Vector fuseFailNoMatch;
+
+    /** Insts packed into the slot of another, by width class */
+    Stats::Vector fuseSuccess;
+
+    /** Fraction of packed insts, over the insts issued of that class */
+    Stats::Formula fuseSuccessNorm;
+
+    /** Packed insts that required multi-element packing */
+    Stats::Vector fuseMultiElement;
+    /// MPINHO 17-oct-2026 END ///
+
   public: /* Public for Pipeline to be able to pass it to Decode */
     std::vector<InputBuffer<ForwardInstData>> inputBuffer;
 
@@ -260,6 +291,24 @@ class Execute : public Named
     /** Try and issue instructions from the inputBuffer */
     unsigned int issue(ThreadID thread_id);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Classify the width of an instruction about to issue, if that was
+     *  not done already */
+    void decodeWidth(MinorDynInstPtr inst, ThreadID thread_id);
+
+    /** Account for the width of an instruction just pushed into an FU and
+     *  make it the base of that FU's packing for this cycle, if narrow
+     *  instructions can be packed with it */
+    void openPacking(MinorDynInstPtr inst, FUPipeline *fu,
+        ThreadID thread_id);
+
+    /** Try and pack an instruction into the slot taken this cycle by
+     *  another in the given FU.  Returns true if the instruction was
+     *  issued */
+    bool tryToPack(MinorDynInstPtr inst, unsigned int fu_index,
+        ThreadID thread_id);
+    /// MPINHO 17-oct-2026 END ///
+
     /** Try to act on PC-related events.  Returns true if any were
      *  executed */
     bool tryPCEvents(ThreadID thread_id);
@@ -341,6 +390,8 @@ class Execute : public Named
     /** Pass on input/buffer data to the output if you can */
     void evaluate();
 
+    void regStats(); /// MPINHO 17-oct-2026 ///
+
     void minorTrace() const;
 
     /** After thread suspension, has Execute been drained of in-flight
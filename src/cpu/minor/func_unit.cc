@@ -115,7 +115,8 @@ FUPipeline::FUPipeline(const std::string &name, const MinorFU &description_,
     FUPipelineBase(name, "insts", description_.opLat),
     description(description_),
     timeSource(timeSource_),
-    nextInsertCycle(Cycles(0))
+    nextInsertCycle(Cycles(0)),
+    packHead(MinorDynInst::bubble()) /// MPINHO 17-oct-2026 ///
 {
     /* Issue latencies are set to 1 in calls to addCapability here.
      * Issue latencies are associated with the pipeline as a whole,
@@ -132,6 +133,12 @@ FUPipeline::FUPipeline(const std::string &name, const MinorFU &description_,
             description.opLat, 1);
     }
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /* The instruction that takes the slot plus the packed ones */
+    setIssueCap(description.fuseCap + 1);
+    setWidthCap(description.widthCap);
+    /// MPINHO 17-oct-2026 END ///
+
     for (unsigned int i = 0; i < description.timings.size(); i++) {
         MinorFUTiming &timing = *(description.timings[i]);
 
@@ -196,6 +203,15 @@ FUPipeline::advance()
         /* Don't count stalled cycles as part of the issue latency */
         ++nextInsertCycle;
     }
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /* Packing only happens within the cycle an instruction is pushed */
+    packHead = MinorDynInst::bubble();
+    packing.reset();
+    resetIssueCap();
+    resetWidthCap();
+    /// MPINHO 17-oct-2026 END ///
+
     FUPipelineBase::advance();
 }
 
@@ -49,6 +49,7 @@
 #include "cpu/minor/buffers.hh"
 #include "cpu/minor/dyn_inst.hh"
 #include "cpu/func_unit.hh"
+#include "cpu/packing_criteria.hh" /// MPINHO 17-oct-2026 ///
 #include "cpu/timing_expr.hh"
 #include "params/MinorFU.hh"
 #include "params/MinorFUPool.hh"
@@ -166,6 +167,15 @@ class MinorFU : public SimObject
     /** Extra timing info to give timings to individual ops */
     std::vector<MinorFUTiming *> timings;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Number of extra instructions that can be packed into the slot of
+     *  an instruction issued to this FU, if their width and type match */
+    unsigned fuseCap;
+
+    /** Width this FU has available for the packed instructions */
+    unsigned widthCap;
+    /// MPINHO 17-oct-2026 END ///
+
   public:
     MinorFU(const MinorFUParams *params) :
         SimObject(params),
@@ -173,7 +183,11 @@ class MinorFU : public SimObject
         opLat(params->opLat),
         issueLat(params->issueLat),
         cantForwardFromFUIndices(params->cantForwardFromFUIndices),
-        timings(params->timings)
+        timings(params->timings),
+        /// MPINHO 17-oct-2026 BEGIN ///
+        fuseCap(params->fuseCap),
+        widthCap(params->widthCap)
+        /// MPINHO 17-oct-2026 END ///
     { }
 };
 
@@ -243,6 +257,16 @@ class FUPipeline : public FUPipelineBase, public FuncUnit
      *  instruction can be pushed straightaway */
     Cycles nextInsertCycle;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Fuseable instruction pushed into the pipeline this cycle, which
+     *  narrow instructions can be packed with.  A bubble if there is
+     *  none */
+    MinorDynInstPtr packHead;
+
+    /** Width packing of the instructions sharing this cycle's slot */
+    PackingSlot packing;
+    /// MPINHO 17-oct-2026 END ///
+
   public:
     FUPipeline(const std::string &name, const MinorFU &description_,
         ClockedObject &timeSource_);
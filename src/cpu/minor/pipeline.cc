@@ -111,6 +111,7 @@ Pipeline::regStats()
     Ticked::regStats();
 
     fetch2.regStats();
+    execute.regStats(); /// MPINHO 17-oct-2026 ///
 }
 
 void
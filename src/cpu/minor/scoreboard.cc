@@ -286,6 +286,27 @@ Scoreboard::canInstIssue(MinorDynInstPtr inst,
     return ret;
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+bool
+Scoreboard::hasInFlightSrcs(MinorDynInstPtr inst,
+    ThreadContext *thread_context)
+{
+    StaticInstPtr staticInst = inst->staticInst;
+    unsigned int num_srcs = staticInst->numSrcRegs();
+
+    for (unsigned int src_index = 0; src_index < num_srcs; src_index++) {
+        RegId reg = flattenRegIndex(staticInst->srcRegIdx(src_index),
+            thread_context);
+        unsigned short int index;
+
+        if (findIndex(reg, index) && numResults[index] != 0)
+            return true;
+    }
+
+    return false;
+}
+/// MPINHO 17-oct-2026 END ///
+
 void
 Scoreboard::minorTrace() const
 {
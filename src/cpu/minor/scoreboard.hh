@@ -135,6 +135,14 @@ class Scoreboard : public Named
         const std::vector<bool> *cant_forward_from_fu_indices,
         Cycles now, ThreadContext *thread_context);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Are any of this instruction's source registers still due to be
+     *  written by marked-up instructions in flight?  If so, their values
+     *  would be forwarded and are not in the register file yet */
+    bool hasInFlightSrcs(MinorDynInstPtr inst,
+        ThreadContext *thread_context);
+    /// MPINHO 17-oct-2026 END ///
+
     /** MinorTraceIF interface */
     void minorTrace() const;
 };
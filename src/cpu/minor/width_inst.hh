@@ -0,0 +1,122 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+#ifndef __CPU_MINOR_WIDTH_INST_HH__
+#define __CPU_MINOR_WIDTH_INST_HH__
+
+#include "arch/registers.hh"
+#include "cpu/func_unit_width.hh"
+#include "cpu/minor/dyn_inst.hh"
+#include "cpu/reg_class.hh"
+#include "cpu/simple_thread.hh"
+#include "cpu/width_info.hh"
+
+class MinorCPU;
+
+namespace Minor
+{
+
+class WidthInst;
+
+/** Types the WidthDecoder takes from its Impl, so that Minor can classify
+ *  instruction widths with the same decoder as O3 */
+struct WidthImpl
+{
+    typedef MinorCPU O3CPU;
+    typedef WidthInst *DynInstPtr;
+};
+
+/** View of a MinorDynInst through the interface the WidthDecoder expects
+ *  from an O3 dynamic instruction.
+ *
+ *  Minor has no renamed registers, so source operands are read from the
+ *  thread's architectural state.  A view must only be taken once the
+ *  scoreboard shows that no source is still in flight, as the values are
+ *  otherwise not in the register file yet */
+class WidthInst
+{
+  protected:
+    /** The instruction viewed */
+    MinorDynInstPtr inst;
+
+    /** Thread holding the source operand values */
+    SimpleThread &thread;
+
+    /** Minor does not predict widths, this is never set */
+    WidthInfo predWidth;
+
+  public:
+    const StaticInstPtr &staticInst;
+
+  public:
+    WidthInst(const MinorDynInstPtr &inst_, SimpleThread &thread_) :
+        inst(inst_),
+        thread(thread_),
+        staticInst(inst_->staticInst)
+    { }
+
+  public:
+    Addr instAddr() const { return inst->pc.instAddr(); }
+
+    bool isVector() const { return staticInst->isVector(); }
+
+    int numSrcRegs() const { return staticInst->numSrcRegs(); }
+
+    int numDestRegs() const { return staticInst->numDestRegs(); }
+
+    const RegId &srcRegIdx(int idx) const
+    { return staticInst->srcRegIdx(idx); }
+
+    /** There is no physical register to look up in a precision board */
+    PhysRegIdPtr renamedSrcRegIdx(int idx) const { return nullptr; }
+
+    RegVal
+    readIntRegOperand(const StaticInst *si, int idx)
+    {
+        const RegId &reg = si->srcRegIdx(idx);
+        assert(reg.isIntReg());
+        return thread.readIntReg(reg.index());
+    }
+
+    const TheISA::VecRegContainer &
+    readVecRegOperand(const StaticInst *si, int idx) const
+    {
+        const RegId &reg = si->srcRegIdx(idx);
+        assert(reg.isVecReg());
+        return thread.readVecReg(reg);
+    }
+
+    /** Architectural register reads are not counted in Minor */
+    const TheISA::VecRegContainer &
+    readVecRegOperandNoStats(const StaticInst *si, int idx) const
+    {
+        return readVecRegOperand(si, idx);
+    }
+
+    void setWidth(const WidthInfo &width) { inst->width = width; }
+
+    const WidthInfo &getWidth() const { return inst->width; }
+
+    WidthClass getWidthClass() const { return inst->width.getWidthClass(); }
+
+    /** Width used in an FU, as computed by O3 */
+    int
+    getWidthVal() const
+    {
+        if (isVector()) {
+            if (inst->width.hasWidthInfo())
+                return inst->width.getWidthVal();
+            else
+                return VecSizeBits;
+        }
+
+        return ScalarSizeBits;
+    }
+
+    bool hasPredWidth() const { return false; }
+
+    const WidthInfo &getPredWidth() const { return predWidth; }
+};
+
+}
+
+#endif /* __CPU_MINOR_WIDTH_INST_HH__ */
+/// MPINHO 17-oct-2026 END ///
@@ -31,6 +31,14 @@ from m5.params import *
 from m5.objects.FuncUnit import *
 from m5.objects.FuncUnitConfig import *
 
+### MPINHO 17-oct-2026 BEGIN ###
+class FUGatingPolicy(ScopedEnum):
+    vals = [ 'Disabled', 'Timeout', 'Predictive' ]
+
+class FUSteeringPolicy(ScopedEnum):
+    vals = [ 'RoundRobin', 'Consolidate' ]
+### MPINHO 17-oct-2026 END ###
+
 class FUPool(SimObject):
     type = 'FUPool'
     cxx_header = "cpu/o3/fu_pool.hh"
@@ -42,6 +50,24 @@ class FUPool(SimObject):
                                    "in clk cycles")
     ### MPINHO 23-oct-2019 END ###
 
+    ### MPINHO 17-oct-2026 BEGIN ###
+    # Power gating controller of the SIMD FUs
+    gatingPolicy = Param.FUGatingPolicy('Disabled', "Policy to power off "
+                                        "idle Simd FUs")
+    gatingIdleTimeout = Param.Int(150, "Idle cycles before a Simd FU is "
+                                  "powered off")
+    gateOffLatency = Param.Int(1, "Cycles to power off a Simd FU")
+    wakeUpLatency = Param.Int(3, "Cycles to power on a Simd FU")
+
+    # Choice of FU among the free ones of a capability
+    steeringPolicy = Param.FUSteeringPolicy('RoundRobin', "Policy to "
+                                            "choose a FU: round robin, or "
+                                            "packing into the FUs already "
+                                            "issuing and then the first "
+                                            "free one, to keep the others "
+                                            "idle")
+    ### MPINHO 17-oct-2026 END ###
+
 class DefaultFUPool(FUPool):
     FUList = [ IntALU(), IntMultDiv(), FP_ALU(), FP_MultDiv(), ReadPort(),
                SIMD_Unit(), WritePort(), RdWrPort(), IprPort() ]
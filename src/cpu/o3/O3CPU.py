@@ -48,6 +48,9 @@ from m5.objects.BaseCPU import BaseCPU
 from m5.objects.FUPool import *
 from m5.objects.O3Checker import O3Checker
 from m5.objects.BranchPredictor import *
+### MPINHO 17-oct-2026 BEGIN ###
+from m5.objects.FuncUnit import WidthDefinition, WidthPackingPolicy
+### MPINHO 17-oct-2026 END ###
 
 class FetchPolicy(ScopedEnum):
     vals = [ 'SingleThread', 'RoundRobin', 'Branch', 'IQCount', 'LSQCount' ]
@@ -58,24 +61,13 @@ class SMTQueuePolicy(ScopedEnum):
 class CommitPolicy(ScopedEnum):
     vals = [ 'Aggressive', 'RoundRobin', 'OldestReady' ]
 
-### MPINHO 07-may-2019 BEGIN ###
-class WidthDefinition(ScopedEnum):
-    vals = [ 'Signed', 'Unsigned' ]
+### MPINHO 17-oct-2026 BEGIN ###
+class LoadValuePredPolicy(ScopedEnum):
+    vals = [ 'Disabled', 'LastValue', 'Stride' ]
 
-class WidthPackingPolicy(ScopedEnum):
-    vals = [ 'Disabled', 'Simple', 'Optimal', 'MultiElement' ]
-### MPINHO 07-may-2019 END ###
-
-### MPINHO 26-jul-2019 BEGIN ###
-class WidthClass(ScopedEnum):
-    vals = [ 'NoInfo', 'SimdNoInfo', 'SimdNoPacking', 'SimdPackingAlu',
-             'SimdPackingMult' ]
-### MPINHO 26-jul-2019 END ###
-
-### MPINHO 30-jul-2019 BEGIN ###
-class VecElemSize(ScopedEnum):
-    vals = [ 'Unknown', 'Bit8', 'Bit16', 'Bit32', 'Bit64' ]
-### MPINHO 30-jul-2019 END ###
+class MacroOpFusionPair(ScopedEnum):
+    vals = [ 'CmpBranch', 'AdrpAdd', 'AeseAesmc', 'AesdAesimc' ]
+### MPINHO 17-oct-2026 END ###
 
 class DerivO3CPU(BaseCPU):
     type = 'DerivO3CPU'
@@ -208,6 +200,46 @@ class DerivO3CPU(BaseCPU):
                                                   "requirements")
     ### MPINHO 07-may-2019 END ###
 
+    ### MPINHO 17-oct-2026 BEGIN ###
+    widthAwareRename = Param.Bool(False, "Allocate vector results in "
+                                  "register slices, according to their "
+                                  "predicted width")
+    widthRenamePredictorSize = Param.Unsigned(1024, "Size of the slice "
+                                              "predictor for width-aware "
+                                              "rename")
+    widthPredictorSize = Param.Unsigned(1024, "Size of the width "
+                                        "predictor used at dispatch")
+    widthPredictorCtrBits = Param.Unsigned(2, "Bits of the width "
+                                           "predictor confidence counters")
+    widthPredictorThreshold = Param.Unsigned(2, "Confidence needed to "
+                                             "predict a width")
+    widthHoldBackCycles = Param.Unsigned(0, "Maximum cycles a fuseable "
+                                         "inst waits for a predicted fuse "
+                                         "partner (0 disables hold-back)")
+    quiescentSkipCycles = Param.Cycles(0, "Maximum cycles skipped at once "
+                                       "while the pipeline is quiescent "
+                                       "(0 disables tick skipping)")
+    loadValuePredPolicy = Param.LoadValuePredPolicy('Disabled', "Policy "
+                                                    "of the load value "
+                                                    "predictor")
+    loadValuePredSize = Param.Unsigned(1024, "Size of the load value "
+                                       "predictor")
+    loadValuePredCtrBits = Param.Unsigned(3, "Bits of the load value "
+                                          "predictor confidence counters")
+    loadValuePredThreshold = Param.Unsigned(7, "Confidence needed to "
+                                            "predict a loaded value")
+    moveElimination = Param.Bool(False, "Eliminate register moves and "
+                                 "zeroing idioms at rename")
+    macroOpFusionPairs = VectorParam.MacroOpFusionPair([], "Instruction "
+                                                       "pairs fused into "
+                                                       "one macro-op at "
+                                                       "decode")
+    fetchTargetQueueSize = Param.Unsigned(0, "Fetch targets the branch "
+                                          "predictor runs ahead of fetch, "
+                                          "prefetching them (0 couples "
+                                          "prediction to fetch)")
+    ### MPINHO 17-oct-2026 END ###
+
     def addCheckerCpu(self):
         if buildEnv['TARGET_ISA'] in ['arm']:
             from m5.objects.ArmTLB import ArmTLB
@@ -202,6 +202,11 @@ class DefaultCommit
     /** Has the stage drained? */
     bool isDrained() const;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Is commit only waiting for the ROB head to complete? */
+    bool isQuiescent() const;
+    /// MPINHO 17-oct-2026 END ///
+
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
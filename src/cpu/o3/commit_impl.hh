@@ -438,6 +438,31 @@ DefaultCommit<Impl>::isDrained() const
         interrupt == NoFault;
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+bool
+DefaultCommit<Impl>::isQuiescent() const
+{
+    if (drainPending || interrupt != NoFault)
+        return false;
+
+    for (ThreadID tid : *activeThreads) {
+        if (commitStatus[tid] != Running && commitStatus[tid] != Idle)
+            return false;
+
+        // Traps and squashes are handled on a later tick.
+        if (trapInFlight[tid] || trapSquash[tid] || tcSquash[tid])
+            return false;
+
+        // The head completes through a writeback, which wakes the CPU up.
+        if (!rob->isEmpty(tid) && rob->readHeadInst(tid)->readyToCommit())
+            return false;
+    }
+
+    return true;
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 void
 DefaultCommit<Impl>::takeOverFrom()
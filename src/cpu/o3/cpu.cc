@@ -161,7 +161,12 @@ FullO3CPU<Impl>::FullO3CPU(DerivO3CPUParams *params)
       vecMode(RenameMode<TheISA::ISA>::init(params->isa[0])),
       regFile(params->numPhysIntRegs,
               params->numPhysFloatRegs,
-              params->numPhysVecRegs,
+              /// MPINHO 17-oct-2026 BEGIN ///
+              // With width-aware rename, a register can hold from one to
+              // NumSlices values, the capacity is enforced by rename.
+              params->numPhysVecRegs *
+                  (params->widthAwareRename ? PrecisionBoard::NumSlices : 1),
+              /// MPINHO 17-oct-2026 END ///
               params->numPhysVecPredRegs,
               params->numPhysCCRegs,
               vecMode),
@@ -173,6 +178,10 @@ FullO3CPU<Impl>::FullO3CPU(DerivO3CPUParams *params)
       scoreboard(name() + ".scoreboard",
                  regFile.totalNumPhysRegs()),
 
+      /// MPINHO 17-oct-2026 BEGIN ///
+      precBoard(name() + ".precboard", regFile.numVecPhysRegs()),
+      /// MPINHO 17-oct-2026 END ///
+
       isa(numThreads, NULL),
 
       icachePort(&fetch, this),
@@ -268,6 +277,21 @@ FullO3CPU<Impl>::FullO3CPU(DerivO3CPUParams *params)
     rename.setScoreboard(&scoreboard);
     iew.setScoreboard(&scoreboard);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    widthAwareRename = params->widthAwareRename;
+    if (widthAwareRename) {
+        precBoard.setSliceCapacity(params->numPhysVecRegs *
+                                   PrecisionBoard::NumSlices);
+    }
+    rename.setPrecisionBoard(&precBoard);
+    iew.setPrecisionBoard(&precBoard);
+
+    quiescentSkipCycles = params->quiescentSkipCycles;
+    quiescentRun = 0;
+    quiescentMinRun = params->backComSize + params->forwardComSize + 1;
+    quiescentSkipping = false;
+    /// MPINHO 17-oct-2026 END ///
+
     // Setup the rename map for whichever stages need it.
     for (ThreadID tid = 0; tid < numThreads; tid++) {
         isa[tid] = params->isa[tid];
@@ -316,6 +340,14 @@ FullO3CPU<Impl>::FullO3CPU(DerivO3CPUParams *params)
                 PhysRegIdPtr phys_reg = freeList.getVecReg();
                 renameMap[tid].setEntry(rid, phys_reg);
                 commitRenameMap[tid].setEntry(rid, phys_reg);
+
+                /// MPINHO 17-oct-2026 BEGIN ///
+                // Nothing is known about the initial values.
+                if (params->widthAwareRename) {
+                    precBoard.reserveSlicesVecReg(phys_reg,
+                                                  PrecisionBoard::NumSlices);
+                }
+                /// MPINHO 17-oct-2026 END ///
             }
         } else {
             /* Initialize the vector-element interface */
@@ -569,8 +601,33 @@ FullO3CPU<Impl>::regStats()
         .desc("percentage of vector register file usage per cycle")
         .init(16) // number of buckets
         ;
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    vecRegFileSliceUsage.name(name() + ".vec_reg_file_slice_usage")
+        .desc("vector registers held by reserved slices per cycle")
+        .init(16) // number of buckets
+        ;
+    vecRegFileSliceUsagePerc.name(name() + ".vec_reg_file_slice_usage_perc")
+        .desc("percentage of vector register slices reserved per cycle")
+        .init(16) // number of buckets
+        ;
+    /// MPINHO 17-oct-2026 END ///
     /// MPINHO 27-mar-2019 END ///
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    quiescentSkips
+        .name(name() + ".quiescentSkips")
+        .desc("Number of times the tick was skipped ahead while the "
+              "pipeline was quiescent")
+        .prereq(quiescentSkips);
+
+    quiescentSkippedCycles
+        .name(name() + ".quiescentSkippedCycles")
+        .desc("Total number of cycles not ticked while the pipeline was "
+              "quiescent")
+        .prereq(quiescentSkippedCycles);
+    /// MPINHO 17-oct-2026 END ///
+
     ccRegfileReads
         .name(name() + ".cc_regfile_reads")
         .desc("number of cc regfile reads")
@@ -603,6 +660,18 @@ FullO3CPU<Impl>::tick()
     ++numCycles;
     updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (quiescentSkipping) {
+        // The skipped cycles would not have changed any state.
+        Cycles skipped(curCycle() - lastRunningCycle - 1);
+
+        quiescentSkipping = false;
+        quiescentSkippedCycles += skipped;
+        numCycles += skipped;
+        iew.skipCycles(skipped);
+    }
+    /// MPINHO 17-oct-2026 END ///
+
 //    activity = false;
 
     //Tick each of the stages
@@ -630,6 +699,10 @@ FullO3CPU<Impl>::tick()
         cleanUpRemovedInsts();
     }
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    bool quiescent = quiescentSkipCycles > 0 && updateQuiescentRun();
+    /// MPINHO 17-oct-2026 END ///
+
     if (!tickEvent.scheduled()) {
         if (_status == SwitchedOut) {
             DPRINTF(O3CPU, "Switched out!\n");
@@ -639,6 +712,16 @@ FullO3CPU<Impl>::tick()
             DPRINTF(O3CPU, "Idle!\n");
             lastRunningCycle = curCycle();
             timesIdled++;
+        /// MPINHO 17-oct-2026 BEGIN ///
+        } else if (quiescent) {
+            DPRINTF(O3CPU, "Quiescent, skipping up to %d cycles!\n",
+                    quiescentSkipCycles);
+            lastRunningCycle = curCycle();
+            quiescentSkipping = true;
+            quiescentRun = 0;
+            ++quiescentSkips;
+            schedule(tickEvent, clockEdge(quiescentSkipCycles));
+        /// MPINHO 17-oct-2026 END ///
         } else {
             schedule(tickEvent, clockEdge(Cycles(1)));
             DPRINTF(O3CPU, "Scheduling next tick!\n");
@@ -669,6 +752,16 @@ FullO3CPU<Impl>::tick()
                                    / regFile.numVecElemPhysRegs());
     }
     /// MPINHO 27-mar-2019 END ///
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (widthAwareRename) {
+        unsigned used = precBoard.numUsedSlices();
+
+        vecRegFileSliceUsage.sample(divCeil(used, PrecisionBoard::NumSlices));
+        vecRegFileSliceUsagePerc.sample(used * 100.0 /
+                                        precBoard.getSliceCapacity());
+    }
+    /// MPINHO 17-oct-2026 END ///
 }
 
 template <class Impl>
@@ -1352,6 +1445,7 @@ FullO3CPU<Impl>::getWritableVecReg(PhysRegIdPtr phys_reg)
         -> VecRegContainer&
 {
     vecRegfileWrites++;
+    precBoard.clearWidthVecReg(phys_reg); /// MPINHO 17-oct-2026 ///
     return regFile.getWritableVecReg(phys_reg);
 }
 
@@ -1410,6 +1504,7 @@ void
 FullO3CPU<Impl>::setVecReg(PhysRegIdPtr phys_reg, const VecRegContainer& val)
 {
     vecRegfileWrites++;
+    precBoard.clearWidthVecReg(phys_reg); /// MPINHO 17-oct-2026 ///
     regFile.setVecReg(phys_reg, val);
 }
 
@@ -1475,8 +1570,9 @@ auto
 FullO3CPU<Impl>::getWritableArchVecReg(int reg_idx, ThreadID tid)
         -> VecRegContainer&
 {
-    PhysRegIdPtr phys_reg = commitRenameMap[tid].lookup(
-                RegId(VecRegClass, reg_idx));
+    /// MPINHO 17-oct-2026 BEGIN ///
+    PhysRegIdPtr phys_reg = writableArchReg(RegId(VecRegClass, reg_idx), tid);
+    /// MPINHO 17-oct-2026 END ///
     return getWritableVecReg(phys_reg);
 }
 
@@ -1526,8 +1622,9 @@ void
 FullO3CPU<Impl>::setArchIntReg(int reg_idx, RegVal val, ThreadID tid)
 {
     intRegfileWrites++;
-    PhysRegIdPtr phys_reg = commitRenameMap[tid].lookup(
-            RegId(IntRegClass, reg_idx));
+    /// MPINHO 17-oct-2026 BEGIN ///
+    PhysRegIdPtr phys_reg = writableArchReg(RegId(IntRegClass, reg_idx), tid);
+    /// MPINHO 17-oct-2026 END ///
 
     regFile.setIntReg(phys_reg, val);
 }
@@ -1537,8 +1634,10 @@ void
 FullO3CPU<Impl>::setArchFloatReg(int reg_idx, RegVal val, ThreadID tid)
 {
     fpRegfileWrites++;
-    PhysRegIdPtr phys_reg = commitRenameMap[tid].lookup(
-            RegId(FloatRegClass, reg_idx));
+    /// MPINHO 17-oct-2026 BEGIN ///
+    PhysRegIdPtr phys_reg = writableArchReg(RegId(FloatRegClass, reg_idx),
+                                            tid);
+    /// MPINHO 17-oct-2026 END ///
 
     regFile.setFloatReg(phys_reg, val);
 }
@@ -1548,11 +1647,45 @@ void
 FullO3CPU<Impl>::setArchVecReg(int reg_idx, const VecRegContainer& val,
                                ThreadID tid)
 {
-    PhysRegIdPtr phys_reg = commitRenameMap[tid].lookup(
-                RegId(VecRegClass, reg_idx));
+    /// MPINHO 17-oct-2026 BEGIN ///
+    PhysRegIdPtr phys_reg = writableArchReg(RegId(VecRegClass, reg_idx), tid);
+    /// MPINHO 17-oct-2026 END ///
     setVecReg(phys_reg, val);
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+PhysRegIdPtr
+FullO3CPU<Impl>::writableArchReg(const RegId &arch_reg, ThreadID tid)
+{
+    PhysRegIdPtr phys_reg = commitRenameMap[tid].lookup(arch_reg);
+
+    if (arch_reg.isZeroReg() || !rename.isSharedReg(phys_reg))
+        return phys_reg;
+
+    PhysRegIdPtr new_reg = rename.unshareArchReg(arch_reg, phys_reg, tid);
+
+    switch (arch_reg.classValue()) {
+      case IntRegClass:
+        regFile.setIntReg(new_reg, regFile.readIntReg(phys_reg));
+        break;
+      case FloatRegClass:
+        regFile.setFloatReg(new_reg, regFile.readFloatReg(phys_reg));
+        break;
+      case VecRegClass:
+        regFile.setVecReg(new_reg, regFile.readVecReg(phys_reg));
+        break;
+      default:
+        panic("Unexpected shared register class (%s).",
+              arch_reg.className());
+    }
+
+    commitRenameMap[tid].setEntry(arch_reg, new_reg);
+
+    return new_reg;
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 void
 FullO3CPU<Impl>::setArchVecElem(const RegIndex& reg_idx, const ElemIndex& ldx,
@@ -1823,8 +1956,15 @@ FullO3CPU<Impl>::wakeDependents(const DynInstPtr &inst)
 */
 template <class Impl>
 void
-FullO3CPU<Impl>::wakeCPU()
+FullO3CPU<Impl>::wakeCPU(Event::Priority waker_pri) /// MPINHO 17-oct-2026 ///
 {
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (quiescentSkipping) {
+        endQuiescentSkip(waker_pri);
+        return;
+    }
+    /// MPINHO 17-oct-2026 END ///
+
     if (activityRec.active() || tickEvent.scheduled()) {
         DPRINTF(Activity, "CPU already running.\n");
         return;
@@ -1843,10 +1983,61 @@ FullO3CPU<Impl>::wakeCPU()
     schedule(tickEvent, clockEdge());
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+bool
+FullO3CPU<Impl>::updateQuiescentRun()
+{
+    // Active stages are part of the activity count, so only the
+    // communication in flight in the time buffers is left.
+    int active_stages = 0;
+    for (int idx = 0; idx < activityRec.getNumStages(); ++idx)
+        active_stages += activityRec.getStageActive(idx);
+
+    bool quiescent = _status == Running &&
+                     drainState() == DrainState::Running &&
+                     activityRec.getActivityCount() == active_stages &&
+                     fetch.isQuiescent() &&
+                     iew.isQuiescent() &&
+                     commit.isQuiescent();
+
+    quiescentRun = quiescent ? quiescentRun + 1 : 0;
+
+    // Signals that are not recorded as activity, such as block and
+    // unblock, are in the time buffers for at most their latency.
+    return quiescentRun >= quiescentMinRun;
+}
+
+template <class Impl>
+void
+FullO3CPU<Impl>::endQuiescentSkip(Event::Priority waker_pri)
+{
+    assert(quiescentSkipping && tickEvent.scheduled());
+
+    // Tick when the pipeline would have seen the event without skipping:
+    // on this clock edge only if the event runs before the tick, so the
+    // first clock edge after the last tick at the earliest.
+    bool after_tick = clockEdge() == curTick() &&
+                      waker_pri >= Event::CPU_Tick_Pri;
+    Cycles delay(curCycle() > lastRunningCycle && !after_tick ? 0 : 1);
+
+    if (clockEdge(delay) < tickEvent.when()) {
+        DPRINTF(Activity, "Ending quiescent tick skip\n");
+        reschedule(tickEvent, clockEdge(delay));
+    }
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 void
 FullO3CPU<Impl>::wakeup(ThreadID tid)
 {
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // Interrupts must be seen by a running thread as well.
+    if (quiescentSkipping)
+        endQuiescentSkip(Event::Default_Pri);
+    /// MPINHO 17-oct-2026 END ///
+
     if (this->thread[tid]->status() != ThreadContext::Suspended)
         return;
 
@@ -65,6 +65,7 @@
 #include "cpu/base.hh"
 #include "cpu/simple_thread.hh"
 #include "cpu/timebuf.hh"
+#include "cpu/width_board.hh" /// MPINHO 17-oct-2026
 //#include "cpu/o3/thread_context.hh"
 #include "params/DerivO3CPU.hh"
 #include "sim/process.hh"
@@ -112,7 +113,10 @@ class FullO3CPU : public BaseO3CPU
     typedef O3ThreadState<Impl> ImplState;
     typedef O3ThreadState<Impl> Thread;
 
-    typedef typename std::list<DynInstPtr>::iterator ListIt;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    typedef typename Impl::DynInstList DynInstList;
+    typedef typename DynInstList::iterator ListIt;
+    /// MPINHO 17-oct-2026 END ///
 
     friend class O3ThreadContext<Impl>;
 
@@ -211,6 +215,12 @@ class FullO3CPU : public BaseO3CPU
     /** Schedule tick event, regardless of its current state. */
     void scheduleTickEvent(Cycles delay)
     {
+        /// MPINHO 17-oct-2026 BEGIN ///
+        if (quiescentSkipping) {
+            endQuiescentSkip(Event::Default_Pri);
+            return;
+        }
+        /// MPINHO 17-oct-2026 END ///
         if (tickEvent.squashed())
             reschedule(tickEvent, clockEdge(delay));
         else if (!tickEvent.scheduled())
@@ -222,6 +232,7 @@ class FullO3CPU : public BaseO3CPU
     {
         if (tickEvent.scheduled())
             tickEvent.squash();
+        quiescentSkipping = false; /// MPINHO 17-oct-2026 ///
     }
 
     /**
@@ -432,6 +443,18 @@ class FullO3CPU : public BaseO3CPU
 
     const VecRegContainer& readVecReg(PhysRegIdPtr reg_idx) const;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Read physical vector register without counting a register file
+     * read, for the width tracking, which is not a pipeline access.
+     */
+    const VecRegContainer&
+    readVecRegNoStats(PhysRegIdPtr reg_idx) const
+    {
+        return regFile.readVecReg(reg_idx);
+    }
+    /// MPINHO 17-oct-2026 END ///
+
     /**
      * Read physical vector register for modification.
      */
@@ -553,6 +576,16 @@ class FullO3CPU : public BaseO3CPU
 
     void setArchCCReg(int reg_idx, RegVal val, ThreadID tid);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Returns the committed physical register of an architectural
+     * register, to be written in place. If move elimination shares it with
+     * other mappings, the architectural register is moved to a private
+     * copy first.
+     */
+    PhysRegIdPtr writableArchReg(const RegId &arch_reg, ThreadID tid);
+    /// MPINHO 17-oct-2026 END ///
+
     /** Sets the commit PC state of a specific thread. */
     void pcState(const TheISA::PCState &newPCState, ThreadID tid);
 
@@ -610,7 +643,7 @@ class FullO3CPU : public BaseO3CPU
 #endif
 
     /** List of all the instructions in flight. */
-    std::list<DynInstPtr> instList;
+    DynInstList instList; /// MPINHO 17-oct-2026 ///
 
     /** List of all the instructions that will be removed at the end of this
      *  cycle.
@@ -676,6 +709,11 @@ class FullO3CPU : public BaseO3CPU
     /** Integer Register Scoreboard */
     Scoreboard scoreboard;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Width of the physical vector registers. */
+    PrecisionBoard precBoard;
+    /// MPINHO 17-oct-2026 END ///
+
     std::vector<TheISA::ISA *> isa;
 
     /** Instruction port. Note that it has to appear after the fetch stage. */
@@ -744,8 +782,46 @@ class FullO3CPU : public BaseO3CPU
     void deactivateStage(const StageIdx idx)
     { activityRec.deactivateStage(idx); }
 
-    /** Wakes the CPU, rescheduling the CPU if it's not already active. */
-    void wakeCPU();
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Wakes the CPU, rescheduling the CPU if it's not already active.
+     *  waker_pri is the priority of the event waking the CPU up.
+     */
+    void wakeCPU(Event::Priority waker_pri = Event::Default_Pri);
+    /// MPINHO 17-oct-2026 END ///
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+  private:
+    /**
+     * Checks if no stage can make progress on the next tick without an
+     * external event (memory response, FU completion, cache retry or
+     * interrupt), and updates the number of consecutive such ticks.
+     * @return true once the pipeline has been quiescent for longer than
+     * the longest time buffer latency, so no signal is still in flight.
+     */
+    bool updateQuiescentRun();
+
+    /**
+     * Ends a tick skip, scheduling the tick for the first cycle that can
+     * see the effects of an event of priority waker_pri.
+     */
+    void endQuiescentSkip(Event::Priority waker_pri);
+
+    /** Maximum number of cycles skipped at once, 0 if disabled. */
+    Cycles quiescentSkipCycles;
+
+    /** Consecutive ticks in which the pipeline was quiescent. */
+    unsigned quiescentRun;
+
+    /** Quiescent ticks needed before skipping, more than the longest
+     *  time buffer latency.
+     */
+    unsigned quiescentMinRun;
+
+    /** Whether the tick is scheduled ahead over a quiescent period. */
+    bool quiescentSkipping;
+
+  public:
+    /// MPINHO 17-oct-2026 END ///
 
     virtual void wakeup(ThreadID tid) override;
 
@@ -851,6 +927,23 @@ class FullO3CPU : public BaseO3CPU
     Stats::Histogram vecRegFileUsage;
     //histogram of vector register file usage percentage
     Stats::Histogram vecRegFileUsagePerc;
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Whether vector registers are allocated in slices at rename. */
+    bool widthAwareRename;
+
+    /** Stat for the vector registers held by the reserved slices. */
+    Stats::Histogram vecRegFileSliceUsage;
+
+    /** Stat for the percentage of vector register slices reserved. */
+    Stats::Histogram vecRegFileSliceUsagePerc;
+
+    /** Stat for the number of times the tick was skipped ahead. */
+    Stats::Scalar quiescentSkips;
+
+    /** Stat for the cycles not ticked while the pipeline was quiescent. */
+    Stats::Scalar quiescentSkippedCycles;
+    /// MPINHO 17-oct-2026 END ///
     /// MPINHO 27-mar-2019 END ///
     //number of predicate register file accesses
     mutable Stats::Scalar vecPredRegfileReads;
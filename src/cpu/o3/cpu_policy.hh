@@ -49,7 +49,7 @@
 #include "cpu/o3/store_set.hh"
 
 /// MPINHO 16-mar-2019 BEGIN ///
-#include "cpu/o3/width_decoder.hh"
+#include "cpu/width_decoder.hh"
 
 /// MPINHO 16-mar-2019 END ///
 
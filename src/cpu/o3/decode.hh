@@ -44,9 +44,11 @@
 #define __CPU_O3_DECODE_HH__
 
 #include <queue>
+#include <vector> /// MPINHO 17-oct-2026 ///
 
 #include "base/statistics.hh"
 #include "cpu/timebuf.hh"
+#include "enums/MacroOpFusionPair.hh" /// MPINHO 17-oct-2026 ///
 
 struct DerivO3CPUParams;
 
@@ -154,6 +156,15 @@ class DefaultDecode
      */
     void decodeInsts(ThreadID tid);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Fuses an instruction with the next one to decode if they form one
+     * of the fusion pairs. The next one is then marked as the tail of the
+     * pair, and shares the decode, rename, ROB and IQ slot of the first.
+     */
+    void fuseNext(const DynInstPtr &inst,
+                  const std::queue<DynInstPtr> &insts_to_decode);
+    /// MPINHO 17-oct-2026 END ///
+
   private:
     /** Inserts a thread's instructions into the skid buffer, to be decoded
      * once decode unblocks.
@@ -273,6 +284,11 @@ class DefaultDecode
     /** The width of decode, in instructions. */
     unsigned decodeWidth;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Instruction pairs fused into one macro-op. */
+    std::vector<MacroOpFusionPair> fusionPairs;
+    /// MPINHO 17-oct-2026 END ///
+
     /** Index of instructions being sent to rename. */
     unsigned toRenameIndex;
 
@@ -320,6 +336,12 @@ class DefaultDecode
     Stats::Scalar decodeDecodedInsts;
     /** Stat for total number of squashed instructions. */
     Stats::Scalar decodeSquashedInsts;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Stat for number of pairs fused into one macro-op, by pair. */
+    Stats::Vector decodeFusedPairs;
+    /** Stat for fraction of decoded instructions that were fused. */
+    Stats::Formula decodeFusedRate;
+    /// MPINHO 17-oct-2026 END ///
 };
 
 #endif // __CPU_O3_DECODE_HH__
@@ -48,6 +48,7 @@
 #include "config/the_isa.hh"
 #include "cpu/o3/decode.hh"
 #include "cpu/inst_seq.hh"
+#include "cpu/o3/macro_op_fusion.hh" /// MPINHO 17-oct-2026 ///
 #include "debug/Activity.hh"
 #include "debug/Decode.hh"
 #include "debug/O3PipeView.hh"
@@ -66,6 +67,7 @@ DefaultDecode<Impl>::DefaultDecode(O3CPU *_cpu, DerivO3CPUParams *params)
       commitToDecodeDelay(params->commitToDecodeDelay),
       fetchToDecodeDelay(params->fetchToDecodeDelay),
       decodeWidth(params->decodeWidth),
+      fusionPairs(params->macroOpFusionPairs), /// MPINHO 17-oct-2026 ///
       numThreads(params->numThreads)
 {
     if (decodeWidth > Impl::MaxWidth)
@@ -165,6 +167,25 @@ DefaultDecode<Impl>::regStats()
         .name(name() + ".SquashedInsts")
         .desc("Number of squashed instructions handled by decode")
         .prereq(decodeSquashedInsts);
+    /// MPINHO 17-oct-2026 BEGIN ///
+    decodeFusedPairs
+        .init(static_cast<int>(MacroOpFusionPair::Num_MacroOpFusionPair))
+        .name(name() + ".FusedPairs")
+        .desc("Number of instruction pairs fused into one macro-op")
+        .flags(Stats::total)
+        ;
+    for (int i = 0;
+         i < static_cast<int>(MacroOpFusionPair::Num_MacroOpFusionPair);
+         i++) {
+        decodeFusedPairs
+            .subname(i, MacroOpFusionPairStrings[i]);
+    }
+    decodeFusedRate
+        .name(name() + ".FusedRate")
+        .desc("Fraction of decoded instructions fused into a macro-op")
+        .precision(6);
+    decodeFusedRate = 2 * sum(decodeFusedPairs) / decodeDecodedInsts;
+    /// MPINHO 17-oct-2026 END ///
 }
 
 template<class Impl>
@@ -671,7 +692,15 @@ DefaultDecode<Impl>::decodeInsts(ThreadID tid)
 
     DPRINTF(Decode, "[tid:%u]: Sending instruction to rename.\n",tid);
 
-    while (insts_available > 0 && toRenameIndex < decodeWidth) {
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // The tail of a fused pair does not take a slot of its own, and is
+    // always sent with its head, even if the width is exhausted by then.
+    unsigned fused_insts = 0;
+
+    while (insts_available > 0 && toRenameIndex < Impl::MaxWidth &&
+           (toRenameIndex - fused_insts < decodeWidth ||
+            insts_to_decode.front()->fusedTail)) {
+    /// MPINHO 17-oct-2026 END ///
         assert(!insts_to_decode.empty());
 
         DynInstPtr inst = std::move(insts_to_decode.front());
@@ -711,6 +740,14 @@ DefaultDecode<Impl>::decodeInsts(ThreadID tid)
         ++decodeDecodedInsts;
         --insts_available;
 
+        /// MPINHO 17-oct-2026 BEGIN ///
+        if (inst->fusedTail) {
+            ++fused_insts;
+        } else if (insts_available > 0) {
+            fuseNext(inst, insts_to_decode);
+        }
+        /// MPINHO 17-oct-2026 END ///
+
 #if TRACING_ON
         if (DTRACE(O3PipeView)) {
             inst->decodeTick = curTick() - inst->fetchTick;
@@ -769,4 +806,40 @@ DefaultDecode<Impl>::decodeInsts(ThreadID tid)
     }
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+void
+DefaultDecode<Impl>::fuseNext(const DynInstPtr &inst,
+                              const std::queue<DynInstPtr> &insts_to_decode)
+{
+    // The tail is sent in this cycle whatever the width left, but it must
+    // still fit in the time buffer, so the pair is never split.
+    if (fusionPairs.empty() || toRenameIndex >= Impl::MaxWidth)
+        return;
+
+    const DynInstPtr &next = insts_to_decode.front();
+
+    if (next->isSquashed() || inst->readPredTaken() ||
+        inst->isMicroop() || next->isMicroop()) {
+        return;
+    }
+
+    for (auto pair : fusionPairs) {
+        if (fusesWith(pair, inst->staticInst->machInst,
+                      next->staticInst->machInst)) {
+            DPRINTF(Decode, "[tid:%u]: Fusing [sn:%lli] PC %s into "
+                    "[sn:%lli] PC %s (%s).\n", inst->threadNumber,
+                    next->seqNum, next->pcState(), inst->seqNum,
+                    inst->pcState(),
+                    MacroOpFusionPairStrings[static_cast<int>(pair)]);
+
+            next->fusedTail = true;
+            inst->fusedTailInst = next;
+            ++decodeFusedPairs[static_cast<int>(pair)];
+            return;
+        }
+    }
+}
+/// MPINHO 17-oct-2026 END ///
+
 #endif//__CPU_O3_DECODE_IMPL_HH__
@@ -45,47 +45,44 @@
 
 #include "cpu/o3/comm.hh"
 
-/** Node in a linked list. */
-template <class DynInstPtr>
-class DependencyEntry
-{
-  public:
-    DependencyEntry()
-        : inst(NULL), next(NULL)
-    { }
-
-    DynInstPtr inst;
-    //Might want to include data about what arch. register the
-    //dependence is waiting on.
-    DependencyEntry<DynInstPtr> *next;
-};
-
-/** Array of linked list that maintains the dependencies between
- * producing instructions and consuming instructions.  Each linked
- * list represents a single physical register, having the future
- * producer of the register's value, and all consumers waiting on that
- * value on the list.  The head node of each linked list represents
- * the producing instruction of that register.  Instructions are put
- * on the list upon reaching the IQ, and are removed from the list
- * either when the producer completes, or the instruction is squashed.
+/// MPINHO 17-oct-2026 BEGIN ///
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "base/cprintf.hh"
+
+/** Bit matrix that maintains the dependencies between producing
+ * instructions and consuming instructions.  Each row represents a single
+ * physical register, having the future producer of the register's value,
+ * and one bit set for each consumer waiting on that value.  Consumers are
+ * given a column (slot) when they first wait on a register, kept in the
+ * instruction's depSlot, and release it once they no longer wait on any
+ * register.  Instructions are put on the matrix upon reaching the IQ, and
+ * are removed from it either when the producer completes, or the
+ * instruction is squashed.  Waking up or removing a consumer is a bit
+ * operation instead of a linked list traversal.
 */
 template <class DynInstPtr>
 class DependencyGraph
 {
   public:
-    typedef DependencyEntry<DynInstPtr> DepEntry;
-
     /** Default construction.  Must call resize() prior to use. */
     DependencyGraph()
-        : numEntries(0), memAllocCounter(0), nodesTraversed(0), nodesRemoved(0)
+        : numEntries(0), numWords(0), numDeps(0), nodesTraversed(0),
+          nodesRemoved(0)
     { }
 
     ~DependencyGraph();
 
-    /** Resize the dependency graph to have num_entries registers. */
-    void resize(int num_entries);
+    /** Resize the dependency graph to have num_entries registers and room
+     *  for num_slots waiting instructions before growing.
+     */
+    void resize(int num_entries, int num_slots = 64);
 
-    /** Clears all of the linked lists. */
+    /** Clears all of the rows. */
     void reset();
 
     /** Inserts an instruction to be dependent on the given index. */
@@ -93,42 +90,84 @@ class DependencyGraph
 
     /** Sets the producing instruction of a given register. */
     void setInst(PhysRegIndex idx, const DynInstPtr &new_inst)
-    { dependGraph[idx].inst = new_inst; }
+    { producers[idx] = new_inst; }
 
     /** Clears the producing instruction. */
     void clearInst(PhysRegIndex idx)
-    { dependGraph[idx].inst = NULL; }
+    { producers[idx] = NULL; }
+
+    /** Returns the producing instruction of a register, if in flight. */
+    const DynInstPtr &producer(PhysRegIndex idx) const
+    { return producers[idx]; }
 
-    /** Removes an instruction from a single linked list. */
+    /** Removes an instruction from a single row. */
     void remove(PhysRegIndex idx, const DynInstPtr &inst_to_remove);
 
-    /** Removes and returns the newest dependent of a specific register. */
+    /** Removes and returns the dependent of a specific register held in
+     *  the lowest-indexed slot. Slots are reused as instructions come and
+     *  go, so this is not the oldest dependent.
+     */
     DynInstPtr pop(PhysRegIndex idx);
 
     /** Checks if the entire dependency graph is empty. */
-    bool empty() const;
+    bool empty() const { return numDeps == 0; }
 
     /** Checks if there are any dependents on a specific register. */
-    bool empty(PhysRegIndex idx) const { return !dependGraph[idx].next; }
+    bool empty(PhysRegIndex idx) const { return !numWaiting[idx]; }
 
     /** Debugging function to dump out the dependency graph.
      */
     void dump();
 
   private:
-    /** Array of linked lists.  Each linked list is a list of all the
-     *  instructions that depend upon a given register.  The actual
-     *  register's index is used to index into the graph; ie all
-     *  instructions in flight that are dependent upon r34 will be
-     *  in the linked list of dependGraph[34].
+    /** Bit words of a register row. */
+    uint64_t *row(PhysRegIndex idx) { return &waiting[idx * numWords]; }
+
+    /** Gives a slot to an instruction that starts waiting. */
+    int allocSlot(const DynInstPtr &inst);
+
+    /** Drops one dependence of the instruction in a slot, freeing the slot
+     *  once it does not wait on any register.
+     */
+    void releaseSlot(int slot);
+
+    /** Adds 64 slots, keeping the existing rows. */
+    void grow();
+
+    /** Takes out a repeated dependence of a slot on a register, if any. */
+    bool takeRepeated(PhysRegIndex idx, int slot);
+
+    /** Producing instruction of each register. */
+    std::vector<DynInstPtr> producers;
+
+    /** Waiting bit matrix, numWords words per register. */
+    std::vector<uint64_t> waiting;
+
+    /** Number of instructions waiting on each register. */
+    std::vector<unsigned> numWaiting;
+
+    /** Instruction holding each slot. */
+    std::vector<DynInstPtr> slotInsts;
+
+    /** Number of registers each slot instruction is waiting on. */
+    std::vector<unsigned> slotDeps;
+
+    /** Free slots. */
+    std::vector<int> freeSlots;
+
+    /** Dependences beyond the first of a slot on the same register, as an
+     *  instruction waits once for each source operand.
      */
-    std::vector<DepEntry> dependGraph;
+    std::vector<std::pair<PhysRegIndex, int> > repeatedDeps;
 
-    /** Number of linked lists; identical to the number of registers. */
+    /** Number of rows; identical to the number of registers. */
     int numEntries;
 
-    // Debug variable, remove when done testing.
-    unsigned memAllocCounter;
+    /** Number of 64-bit words per row. */
+    int numWords;
+
+    /** Total number of dependences in the matrix. */
+    unsigned numDeps;
 
   public:
     // Debug variable, remove when done testing.
@@ -144,10 +183,44 @@ DependencyGraph<DynInstPtr>::~DependencyGraph()
 
 template <class DynInstPtr>
 void
-DependencyGraph<DynInstPtr>::resize(int num_entries)
+DependencyGraph<DynInstPtr>::resize(int num_entries, int num_slots)
 {
     numEntries = num_entries;
-    dependGraph.resize(numEntries);
+    numWords = 0;
+    numDeps = 0;
+    producers.assign(numEntries, NULL);
+    numWaiting.assign(numEntries, 0);
+    waiting.clear();
+    repeatedDeps.clear();
+    slotInsts.clear();
+    slotDeps.clear();
+    freeSlots.clear();
+
+    while (slotInsts.size() < (size_t)num_slots)
+        grow();
+}
+
+template <class DynInstPtr>
+void
+DependencyGraph<DynInstPtr>::grow()
+{
+    int old_words = numWords;
+    std::vector<uint64_t> new_waiting(numEntries * (numWords + 1), 0);
+
+    for (int i = 0; i < numEntries; ++i) {
+        for (int w = 0; w < old_words; ++w)
+            new_waiting[i * (old_words + 1) + w] = waiting[i * old_words + w];
+    }
+    waiting.swap(new_waiting);
+    ++numWords;
+
+    int first_slot = slotInsts.size();
+    slotInsts.resize(first_slot + 64, NULL);
+    slotDeps.resize(first_slot + 64, 0);
+
+    // Lower slots are handed out first.
+    for (int slot = first_slot + 63; slot >= first_slot; --slot)
+        freeSlots.push_back(slot);
 }
 
 template <class DynInstPtr>
@@ -155,27 +228,49 @@ void
 DependencyGraph<DynInstPtr>::reset()
 {
     // Clear the dependency graph
-    DepEntry *curr;
-    DepEntry *prev;
+    for (int slot = 0; slot < (int)slotInsts.size(); ++slot) {
+        if (slotInsts[slot]) {
+            slotInsts[slot]->depSlot = -1;
+            slotInsts[slot] = NULL;
+            slotDeps[slot] = 0;
+            freeSlots.push_back(slot);
+        }
+    }
 
     for (int i = 0; i < numEntries; ++i) {
-        curr = dependGraph[i].next;
+        producers[i] = NULL;
+        numWaiting[i] = 0;
+    }
+    std::fill(waiting.begin(), waiting.end(), 0);
+    repeatedDeps.clear();
+    numDeps = 0;
+}
 
-        while (curr) {
-            memAllocCounter--;
+template <class DynInstPtr>
+int
+DependencyGraph<DynInstPtr>::allocSlot(const DynInstPtr &inst)
+{
+    if (freeSlots.empty())
+        grow();
 
-            prev = curr;
-            curr = prev->next;
-            prev->inst = NULL;
+    int slot = freeSlots.back();
+    freeSlots.pop_back();
 
-            delete prev;
-        }
+    slotInsts[slot] = inst;
+    inst->depSlot = slot;
+    return slot;
+}
 
-        if (dependGraph[i].inst) {
-            dependGraph[i].inst = NULL;
-        }
+template <class DynInstPtr>
+void
+DependencyGraph<DynInstPtr>::releaseSlot(int slot)
+{
+    assert(slotDeps[slot] > 0);
 
-        dependGraph[i].next = NULL;
+    if (--slotDeps[slot] == 0) {
+        slotInsts[slot]->depSlot = -1;
+        slotInsts[slot] = NULL;
+        freeSlots.push_back(slot);
     }
 }
 
@@ -184,115 +279,116 @@ void
 DependencyGraph<DynInstPtr>::insert(PhysRegIndex idx,
         const DynInstPtr &new_inst)
 {
-    //Add this new, dependent instruction at the head of the dependency
-    //chain.
-
-    // First create the entry that will be added to the head of the
-    // dependency chain.
-    DepEntry *new_entry = new DepEntry;
-    new_entry->next = dependGraph[idx].next;
-    new_entry->inst = new_inst;
-
-    // Then actually add it to the chain.
-    dependGraph[idx].next = new_entry;
-
-    ++memAllocCounter;
+    int slot = new_inst->depSlot;
+    if (slot < 0)
+        slot = allocSlot(new_inst);
+    assert(slotInsts[slot] == new_inst);
+
+    uint64_t &word = row(idx)[slot / 64];
+    uint64_t bit = 1ULL << (slot % 64);
+
+    if (word & bit)
+        repeatedDeps.push_back(std::make_pair(idx, slot));
+    else
+        word |= bit;
+
+    ++slotDeps[slot];
+    ++numWaiting[idx];
+    ++numDeps;
 }
 
+template <class DynInstPtr>
+bool
+DependencyGraph<DynInstPtr>::takeRepeated(PhysRegIndex idx, int slot)
+{
+    for (auto it = repeatedDeps.begin(); it != repeatedDeps.end(); ++it) {
+        if (it->first == idx && it->second == slot) {
+            repeatedDeps.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
 
 template <class DynInstPtr>
 void
 DependencyGraph<DynInstPtr>::remove(PhysRegIndex idx,
                                     const DynInstPtr &inst_to_remove)
 {
-    DepEntry *prev = &dependGraph[idx];
-    DepEntry *curr = dependGraph[idx].next;
-
-    // Make sure curr isn't NULL.  Because this instruction is being
-    // removed from a dependency list, it must have been placed there at
-    // an earlier time.  The dependency chain should not be empty,
-    // unless the instruction dependent upon it is already ready.
-    if (curr == NULL) {
-        return;
-    }
-
-    nodesRemoved++;
+    int slot = inst_to_remove->depSlot;
 
-    // Find the instruction to remove within the dependency linked list.
-    while (curr->inst != inst_to_remove) {
-        prev = curr;
-        curr = curr->next;
-        nodesTraversed++;
-
-        assert(curr != NULL);
-    }
+    // The instruction may no longer be waiting on this register if it
+    // was woken up by it already.
+    if (slot < 0)
+        return;
 
-    // Now remove this instruction from the list.
-    prev->next = curr->next;
+    uint64_t &word = row(idx)[slot / 64];
+    uint64_t bit = 1ULL << (slot % 64);
 
-    --memAllocCounter;
+    if (!(word & bit))
+        return;
 
-    // Could push this off to the destructor of DependencyEntry
-    curr->inst = NULL;
+    nodesRemoved++;
 
-    delete curr;
+    if (repeatedDeps.empty() || !takeRepeated(idx, slot))
+        word &= ~bit;
+    --numWaiting[idx];
+    --numDeps;
+    releaseSlot(slot);
 }
 
 template <class DynInstPtr>
 DynInstPtr
 DependencyGraph<DynInstPtr>::pop(PhysRegIndex idx)
 {
-    DepEntry *node;
-    node = dependGraph[idx].next;
-    DynInstPtr inst = NULL;
-    if (node) {
-        inst = node->inst;
-        dependGraph[idx].next = node->next;
-        node->inst = NULL;
-        memAllocCounter--;
-        delete node;
-    }
-    return inst;
-}
+    if (!numWaiting[idx])
+        return NULL;
 
-template <class DynInstPtr>
-bool
-DependencyGraph<DynInstPtr>::empty() const
-{
-    for (int i = 0; i < numEntries; ++i) {
-        if (!empty(i))
-            return false;
+    uint64_t *words = row(idx);
+    int w = 0;
+    while (!words[w]) {
+        ++w;
+        nodesTraversed++;
     }
-    return true;
+
+    int slot = w * 64 + findLsbSet(words[w]);
+    if (repeatedDeps.empty() || !takeRepeated(idx, slot))
+        words[w] &= words[w] - 1;
+    --numWaiting[idx];
+    --numDeps;
+
+    DynInstPtr inst = slotInsts[slot];
+    releaseSlot(slot);
+    return inst;
 }
 
 template <class DynInstPtr>
 void
 DependencyGraph<DynInstPtr>::dump()
 {
-    DepEntry *curr;
-
     for (int i = 0; i < numEntries; ++i)
     {
-        curr = &dependGraph[i];
-
-        if (curr->inst) {
+        if (producers[i]) {
             cprintf("dependGraph[%i]: producer: %s [sn:%lli] consumer: ",
-                    i, curr->inst->pcState(), curr->inst->seqNum);
+                    i, producers[i]->pcState(), producers[i]->seqNum);
         } else {
             cprintf("dependGraph[%i]: No producer. consumer: ", i);
         }
 
-        while (curr->next != NULL) {
-            curr = curr->next;
+        uint64_t *words = row(i);
+        for (int w = 0; w < numWords; ++w) {
+            for (uint64_t bits = words[w]; bits; bits &= bits - 1) {
+                const DynInstPtr &inst =
+                    slotInsts[w * 64 + findLsbSet(bits)];
 
-            cprintf("%s [sn:%lli] ",
-                    curr->inst->pcState(), curr->inst->seqNum);
+                cprintf("%s [sn:%lli] ", inst->pcState(), inst->seqNum);
+            }
         }
 
         cprintf("\n");
     }
-    cprintf("memAllocCounter: %i\n", memAllocCounter);
+    cprintf("dependences: %i, slots: %i\n", numDeps, slotInsts.size());
 }
+/// MPINHO 17-oct-2026 END ///
 
 #endif // __CPU_O3_DEP_GRAPH_HH__
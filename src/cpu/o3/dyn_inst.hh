@@ -47,13 +47,14 @@
 #include <array>
 
 #include "arch/isa_traits.hh"
+#include "base/pool_alloc.hh" /// MPINHO 17-oct-2026 ///
 #include "config/the_isa.hh"
 #include "cpu/base_dyn_inst.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/o3/cpu.hh"
 #include "cpu/o3/isa_specific.hh"
-#include "cpu/o3/width_info.hh"
 #include "cpu/reg_class.hh"
+#include "cpu/width_info.hh"
 #include "enums/VecElemSize.hh" /// MPINHO 30-jul-2019 ///
 #include "enums/WidthClass.hh" /// MPINHO 29-jul-2019 ///
 
@@ -91,6 +92,31 @@ class BaseO3DynInst : public BaseDynInst<Impl>
 
     ~BaseO3DynInst();
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Dynamic instructions are recycled through a block pool, as one is
+     *  created for every fetched instruction and deleted as soon as its
+     *  last reference goes away.
+     */
+    static void *
+    operator new(size_t size)
+    {
+        static_assert(alignof(BaseO3DynInst) <= alignof(std::max_align_t),
+                      "Pool blocks are not aligned for BaseO3DynInst");
+        if (size != sizeof(BaseO3DynInst))
+            return ::operator new(size);
+        return BlockPool<sizeof(BaseO3DynInst)>::allocate();
+    }
+
+    static void
+    operator delete(void *ptr, size_t size)
+    {
+        if (size != sizeof(BaseO3DynInst))
+            ::operator delete(ptr);
+        else
+            BlockPool<sizeof(BaseO3DynInst)>::release(ptr);
+    }
+    /// MPINHO 17-oct-2026 END ///
+
     /** Executes the instruction.*/
     Fault execute();
 
@@ -291,6 +317,17 @@ class BaseO3DynInst : public BaseDynInst<Impl>
         return this->cpu->readVecReg(this->_srcRegIdx[idx]);
     }
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Reads a source vector register operand without counting a
+     *  register file read, for the width tracking.
+     */
+    const VecRegContainer&
+    readVecRegOperandNoStats(const StaticInst *si, int idx) const
+    {
+        return this->cpu->readVecRegNoStats(this->_srcRegIdx[idx]);
+    }
+    /// MPINHO 17-oct-2026 END ///
+
     /**
      * Read destination vector register operand for modification.
      */
@@ -456,11 +493,10 @@ protected:
 public:
 
     /** Set the instruction width information. */
-    void setWidth(WidthInfo _width) { width = _width; }
+    void setWidth(const WidthInfo &_width) { width = _width; }
 
     /** Get the instruction width information. */
-    // TODO: change this to reference.
-    WidthInfo getWidth() { return width; }
+    const WidthInfo &getWidth() const { return width; }
 
     /** Get the instruction width class. */
     WidthClass getWidthClass() { return width.getWidthClass(); }
@@ -471,6 +507,78 @@ public:
     /** Get the instruction elem size. */
     VecElemSize getElemSize() { return width.getElemSize(); }
 /// MPINHO 29-jul-2019 END ///
+
+/// MPINHO 17-oct-2026 BEGIN ///
+protected:
+
+    /** Width predicted at dispatch. */
+    WidthInfo predWidth;
+
+    /** Whether the instruction has a width prediction. */
+    bool widthPredicted;
+
+    /** Number of cycles the issue was held back waiting for a partner. */
+    unsigned widthHoldCycles;
+
+public:
+
+    /** Set the predicted width information. */
+    void
+    setPredWidth(const WidthInfo &_width)
+    {
+        predWidth = _width;
+        widthPredicted = true;
+    }
+
+    /** Get the predicted width information. */
+    const WidthInfo &getPredWidth() const { return predWidth; }
+
+    /** Whether the instruction has a width prediction. */
+    bool hasPredWidth() const { return widthPredicted; }
+
+    /** Get the number of cycles the issue was held back. */
+    unsigned getWidthHoldCycles() const { return widthHoldCycles; }
+
+    /** Count one more cycle of issue held back. */
+    void incWidthHoldCycles() { ++widthHoldCycles; }
+
+    /** Column of the instruction in the IQ dependency matrix, or -1 if it
+     *  is not waiting on any register.
+     */
+    int depSlot;
+
+    /** Whether the value of the load was predicted and its dependents
+     *  woken up before the access completed.
+     */
+    bool valuePredicted;
+
+    /** Value predicted for the destination of the load. */
+    uint64_t predValue;
+
+    /** Cycle the value of the load was predicted. */
+    Cycles valuePredCycle;
+
+    /** Whether rename eliminated the instruction, mapping its destination
+     *  onto its source or the zero register.
+     */
+    bool moveEliminated;
+
+    /** Whether decode fused the instruction into the previous one, as the
+     *  tail of a macro-op. It takes no decode, rename or ROB slot, and
+     *  shares the IQ entry of its head.
+     */
+    bool fusedTail;
+
+    /** Tail fused into the instruction at decode, until the IQ entry of
+     *  the macro-op is handed over to it.
+     */
+    typename Impl::DynInstPtr fusedTailInst;
+
+    /** Whether the tail holds the IQ entry of its macro-op, as its head
+     *  left the IQ first.
+     */
+    bool holdsFusedEntry;
+/// MPINHO 17-oct-2026 END ///
 };
 
 #endif // __CPU_O3_ALPHA_DYN_INST_HH__
@@ -110,6 +110,16 @@ BaseO3DynInst<Impl>::initVars()
 
     _numDestMiscRegs = 0;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    widthPredicted = false;
+    widthHoldCycles = 0;
+    depSlot = -1;
+    valuePredicted = false;
+    moveEliminated = false;
+    fusedTail = false;
+    holdsFusedEntry = false;
+    /// MPINHO 17-oct-2026 END ///
+
 #if TRACING_ON
     // Value -1 indicates that particular phase
     // hasn't happened (yet).
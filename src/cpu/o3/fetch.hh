@@ -109,6 +109,32 @@ class DefaultFetch
         }
     };
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    class PrefetchTranslation : public BaseTLB::Translation
+    {
+      protected:
+        DefaultFetch<Impl> *fetch;
+
+      public:
+        PrefetchTranslation(DefaultFetch<Impl> *_fetch)
+            : fetch(_fetch)
+        {}
+
+        void
+        markDelayed()
+        {}
+
+        void
+        finish(const Fault &fault, const RequestPtr &req, ThreadContext *tc,
+               BaseTLB::Mode mode)
+        {
+            assert(mode == BaseTLB::Execute);
+            fetch->finishPrefetchTranslation(fault, req);
+            delete this;
+        }
+    };
+    /// MPINHO 17-oct-2026 END ///
+
   private:
     /* Event to delay delivery of a fetch translation result in case of
      * a fault and the nop to carry the fault cannot be generated
@@ -234,6 +260,11 @@ class DefaultFetch
     /** Has the stage drained? */
     bool isDrained() const;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Is fetch only waiting for the ITLB, the icache or the back end? */
+    bool isQuiescent() const;
+    /// MPINHO 17-oct-2026 END ///
+
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
@@ -292,6 +323,34 @@ class DefaultFetch
     bool fetchCacheLine(Addr vaddr, ThreadID tid, Addr pc);
     void finishTranslation(const Fault &fault, const RequestPtr &mem_req);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Can the branch predictor of a thread run ahead of fetch? */
+    bool canRunAhead(ThreadID tid) const;
+
+    /**
+     * Predicts the fetch buffer block fetch reaches after the one of the
+     * run-ahead PC, from the BTB, and adds it to the fetch target queue.
+     */
+    void runAhead(ThreadID tid);
+
+    /** Starts the icache prefetch of the oldest unprefetched target. */
+    void issuePrefetch(ThreadID tid);
+
+    /** Sends the icache prefetch of a target once translated. */
+    void finishPrefetchTranslation(const Fault &fault,
+                                   const RequestPtr &req);
+
+    /**
+     * Pops a block fetch is about to read from the fetch target queue.
+     * If it is not the oldest target, the queue is flushed and the
+     * branch predictor runs ahead again from the fetch address.
+     */
+    void consumeFetchTarget(ThreadID tid, Addr block_pc, Addr fetch_addr);
+
+    /** Empties the fetch target queue, to run ahead again from a PC. */
+    void flushFetchTargets(ThreadID tid, Addr pc);
+    /// MPINHO 17-oct-2026 END ///
+
 
     /** Check if an interrupt is pending and that we need to handle
      */
@@ -488,6 +547,50 @@ class DefaultFetch
     /** Whether or not the fetch buffer data is valid. */
     bool fetchBufferValid[Impl::MaxThreads];
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Icache prefetch of a fetch target. */
+    enum class PrefetchState
+    {
+        /** Not prefetched yet. */
+        None,
+        /** Waiting for the ITLB. */
+        Translating,
+        /** Sent to the icache. */
+        Sent,
+        /** Not prefetched, the line was covered or could not be sent. */
+        Skipped
+    };
+
+    /** Fetch buffer block that fetch is predicted to read. */
+    struct FetchTarget
+    {
+        /** Address of the fetch buffer block. */
+        Addr blockPC;
+        /** State of its icache prefetch. */
+        PrefetchState prefetch;
+        /** Request of its icache prefetch. */
+        RequestPtr req;
+    };
+
+    /** Size of the fetch target queue, 0 if the front end is coupled. */
+    unsigned ftqSize;
+
+    /** Fetch target queue of each thread, oldest target first. */
+    std::deque<FetchTarget> ftq[Impl::MaxThreads];
+
+    /** PC the branch predictor runs ahead from. */
+    Addr ftqPC[Impl::MaxThreads];
+
+    /** Last block fetch took from the fetch target queue. */
+    Addr ftqFetchBlock[Impl::MaxThreads];
+
+    /** Last cache line prefetched, or being fetched, by each thread. */
+    Addr ftqPrefetchLine[Impl::MaxThreads];
+
+    /** Number of prefetches waiting for the ITLB. */
+    unsigned prefetchTranslations;
+    /// MPINHO 17-oct-2026 END ///
+
     /** Size of instructions. */
     int instSize;
 
@@ -568,6 +671,24 @@ class DefaultFetch
     Stats::Formula branchRate;
     /** Number of instruction fetched per cycle. */
     Stats::Formula fetchRate;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Distribution of the fetch target queue occupancy each cycle. */
+    Stats::Distribution ftqOccupancy;
+    /** Number of blocks fetch found at the head of the target queue. */
+    Stats::Scalar ftqHits;
+    /** Number of blocks fetch did not find, flushing the target queue. */
+    Stats::Scalar ftqMisses;
+    /** Number of icache prefetches sent for fetch targets. */
+    Stats::Scalar ftqPrefetches;
+    /** Number of prefetched targets that fetch read. */
+    Stats::Scalar ftqUsefulPrefetches;
+    /** Number of prefetched targets flushed before fetch read them. */
+    Stats::Scalar ftqUselessPrefetches;
+    /** Number of prefetches dropped after translation. */
+    Stats::Scalar ftqDroppedPrefetches;
+    /** Fraction of the prefetches that fetch read. */
+    Stats::Formula ftqPrefetchAccuracy;
+    /// MPINHO 17-oct-2026 END ///
 };
 
 #endif //__CPU_O3_FETCH_HH__
@@ -94,6 +94,10 @@ DefaultFetch<Impl>::DefaultFetch(O3CPU *_cpu, DerivO3CPUParams *params)
       fetchBufferSize(params->fetchBufferSize),
       fetchBufferMask(fetchBufferSize - 1),
       fetchQueueSize(params->fetchQueueSize),
+      /// MPINHO 17-oct-2026 BEGIN ///
+      ftqSize(params->fetchTargetQueueSize),
+      prefetchTranslations(0),
+      /// MPINHO 17-oct-2026 END ///
       numThreads(params->numThreads),
       numFetchingThreads(params->smtNumFetchingThreads),
       finishTranslationEvent(this)
@@ -134,6 +138,11 @@ DefaultFetch<Impl>::DefaultFetch(O3CPU *_cpu, DerivO3CPUParams *params)
         fetchBufferValid[i] = false;
         lastIcacheStall[i] = 0;
         issuePipelinedIfetch[i] = false;
+        /// MPINHO 17-oct-2026 BEGIN ///
+        ftqPC[i] = 0;
+        ftqFetchBlock[i] = MaxAddr;
+        ftqPrefetchLine[i] = MaxAddr;
+        /// MPINHO 17-oct-2026 END ///
     }
 
     branchPred = params->branchPred;
@@ -284,6 +293,55 @@ DefaultFetch<Impl>::regStats()
         .desc("Number of inst fetches per cycle")
         .flags(Stats::total);
     fetchRate = fetchedInsts / cpu->numCycles;
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    ftqOccupancy
+        .init(/* base value */ 0,
+              /* last value */ ftqSize,
+              /* bucket size */ 1)
+        .name(name() + ".ftqOccupancy")
+        .desc("Number of fetch targets queued each cycle")
+        .flags(Stats::pdf);
+
+    ftqHits
+        .name(name() + ".ftqHits")
+        .desc("Number of blocks fetch found at the head of the fetch target"
+              " queue")
+        .prereq(ftqHits);
+
+    ftqMisses
+        .name(name() + ".ftqMisses")
+        .desc("Number of blocks fetch did not find in the fetch target "
+              "queue")
+        .prereq(ftqMisses);
+
+    ftqPrefetches
+        .name(name() + ".ftqPrefetches")
+        .desc("Number of icache prefetches sent for fetch targets")
+        .prereq(ftqPrefetches);
+
+    ftqUsefulPrefetches
+        .name(name() + ".ftqUsefulPrefetches")
+        .desc("Number of prefetched fetch targets read by fetch")
+        .prereq(ftqUsefulPrefetches);
+
+    ftqUselessPrefetches
+        .name(name() + ".ftqUselessPrefetches")
+        .desc("Number of prefetched fetch targets flushed before fetch read "
+              "them")
+        .prereq(ftqUselessPrefetches);
+
+    ftqDroppedPrefetches
+        .name(name() + ".ftqDroppedPrefetches")
+        .desc("Number of fetch target prefetches dropped after translation")
+        .prereq(ftqDroppedPrefetches);
+
+    ftqPrefetchAccuracy
+        .name(name() + ".ftqPrefetchAccuracy")
+        .desc("Fraction of the fetch target prefetches read by fetch")
+        .precision(6);
+    ftqPrefetchAccuracy = ftqUsefulPrefetches / ftqPrefetches;
+    /// MPINHO 17-oct-2026 END ///
 }
 
 template<class Impl>
@@ -341,6 +399,10 @@ DefaultFetch<Impl>::clearStates(ThreadID tid)
     fetchBufferPC[tid] = 0;
     fetchBufferValid[tid] = false;
     fetchQueue[tid].clear();
+    /// MPINHO 17-oct-2026 BEGIN ///
+    flushFetchTargets(tid, pc[tid].instAddr());
+    ftqFetchBlock[tid] = MaxAddr;
+    /// MPINHO 17-oct-2026 END ///
 
     // TODO not sure what to do with priorityList for now
     // priorityList.push_back(tid);
@@ -374,6 +436,11 @@ DefaultFetch<Impl>::resetStage()
 
         fetchQueue[tid].clear();
 
+        /// MPINHO 17-oct-2026 BEGIN ///
+        flushFetchTargets(tid, pc[tid].instAddr());
+        ftqFetchBlock[tid] = MaxAddr;
+        /// MPINHO 17-oct-2026 END ///
+
         priorityList.push_back(tid);
     }
 
@@ -385,6 +452,14 @@ template<class Impl>
 void
 DefaultFetch<Impl>::processCacheCompletion(PacketPtr pkt)
 {
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // Prefetches of fetch targets only bring the line into the icache.
+    if (pkt->req->isPrefetch()) {
+        delete pkt;
+        return;
+    }
+    /// MPINHO 17-oct-2026 END ///
+
     ThreadID tid = cpu->contextToThread(pkt->req->contextId());
 
     DPRINTF(Fetch, "[tid:%u] Waking up from cache miss.\n", tid);
@@ -477,6 +552,12 @@ DefaultFetch<Impl>::isDrained() const
         }
     }
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // Prefetches may still wait for the ITLB, or for the icache to retry.
+    if (prefetchTranslations || cacheBlocked)
+        return false;
+    /// MPINHO 17-oct-2026 END ///
+
     /* The pipeline might start up again in the middle of the drain
      * cycle if the finish translation event is scheduled, so make
      * sure that's not the case.
@@ -484,6 +565,37 @@ DefaultFetch<Impl>::isDrained() const
     return !finishTranslationEvent.scheduled();
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+bool
+DefaultFetch<Impl>::isQuiescent() const
+{
+    for (ThreadID tid : *activeThreads) {
+        switch (fetchStatus[tid]) {
+          case Idle:
+          case Blocked:
+          case ItlbWait:
+          case IcacheWaitResponse:
+          case IcacheWaitRetry:
+          case TrapPending:
+          case QuiescePending:
+            // Translation and icache completions wake the CPU up, the
+            // other states are left through signals from later stages.
+            break;
+
+          default:
+            return false;
+        }
+
+        // The branch predictor can still run ahead.
+        if (canRunAhead(tid) && ftq[tid].size() < ftqSize)
+            return false;
+    }
+
+    return true;
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 void
 DefaultFetch<Impl>::takeOverFrom()
@@ -623,6 +735,11 @@ DefaultFetch<Impl>::fetchCacheLine(Addr vaddr, ThreadID tid, Addr pc)
     DPRINTF(Fetch, "[tid:%i] Fetching cache line %#x for addr %#x\n",
             tid, fetchBufferBlockPC, vaddr);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (ftqSize && fetchBufferBlockPC != ftqFetchBlock[tid])
+        consumeFetchTarget(tid, fetchBufferBlockPC, vaddr);
+    /// MPINHO 17-oct-2026 END ///
+
     // Setup the memReq to do a read of the first instruction's address.
     // Set the appropriate read size and flags as well.
     // Build request here.
@@ -750,6 +867,187 @@ DefaultFetch<Impl>::finishTranslation(const Fault &fault,
     _status = updateFetchStatus();
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+bool
+DefaultFetch<Impl>::canRunAhead(ThreadID tid) const
+{
+    if (stalls[tid].drain)
+        return false;
+
+    switch (fetchStatus[tid]) {
+      case Running:
+      case Squashing:
+      case Blocked:
+      case ItlbWait:
+      case IcacheWaitResponse:
+      case IcacheWaitRetry:
+      case IcacheAccessComplete:
+        return true;
+
+      default:
+        // Fetch waits for a trap, a quiesce or a redirect, that flush
+        // the targets anyway.
+        return false;
+    }
+}
+
+template <class Impl>
+void
+DefaultFetch<Impl>::runAhead(ThreadID tid)
+{
+    if (ftq[tid].size() >= ftqSize)
+        return;
+
+    // Without the instructions, any branch in the BTB is predicted taken,
+    // and the block is left at its first one.
+    Addr block_end = fetchBufferAlignPC(ftqPC[tid]) + fetchBufferSize;
+    Addr next_pc = block_end;
+
+    for (Addr inst_pc = ftqPC[tid]; inst_pc < block_end;
+         inst_pc += instSize) {
+        if (branchPred->BTBValid(inst_pc, tid)) {
+            next_pc = branchPred->BTBLookup(inst_pc, tid).instAddr();
+            break;
+        }
+    }
+
+    DPRINTF(Fetch, "[tid:%i]: Running ahead from %#x to %#x, %i fetch "
+            "targets queued.\n", tid, ftqPC[tid], next_pc,
+            ftq[tid].size() + 1);
+
+    ftqPC[tid] = next_pc;
+    ftq[tid].push_back({fetchBufferAlignPC(next_pc), PrefetchState::None,
+                        nullptr});
+
+    cpu->activityThisCycle();
+}
+
+template <class Impl>
+void
+DefaultFetch<Impl>::issuePrefetch(ThreadID tid)
+{
+    if (cacheBlocked)
+        return;
+
+    for (auto &target : ftq[tid]) {
+        if (target.prefetch != PrefetchState::None)
+            continue;
+
+        // Blocks of a line already prefetched, or being fetched, do not
+        // need a prefetch of their own.
+        Addr line = target.blockPC & ~Addr(cacheBlkSize - 1);
+
+        if (line == ftqPrefetchLine[tid]) {
+            target.prefetch = PrefetchState::Skipped;
+            continue;
+        }
+
+        ftqPrefetchLine[tid] = line;
+
+        // The ITLB drops prefetches that miss in it, so they never walk
+        // the page table.
+        target.req = std::make_shared<Request>(
+            tid, line, cacheBlkSize,
+            Request::INST_FETCH | Request::PREFETCH, cpu->instMasterId(),
+            target.blockPC, cpu->thread[tid]->contextId());
+        target.req->taskId(cpu->taskId());
+        target.prefetch = PrefetchState::Translating;
+
+        DPRINTF(Fetch, "[tid:%i]: Prefetching line %#x for fetch target "
+                "%#x.\n", tid, line, target.blockPC);
+
+        ++prefetchTranslations;
+        PrefetchTranslation *trans = new PrefetchTranslation(this);
+        cpu->itb->translateTiming(target.req, cpu->thread[tid]->getTC(),
+                                  trans, BaseTLB::Execute);
+        return;
+    }
+}
+
+template <class Impl>
+void
+DefaultFetch<Impl>::finishPrefetchTranslation(const Fault &fault,
+                                              const RequestPtr &req)
+{
+    ThreadID tid = cpu->contextToThread(req->contextId());
+
+    assert(prefetchTranslations > 0);
+    --prefetchTranslations;
+
+    auto target = std::find_if(ftq[tid].begin(), ftq[tid].end(),
+                               [&req](const FetchTarget &t)
+                               { return t.req == req; });
+
+    // Flushed while waiting for the ITLB.
+    if (target == ftq[tid].end() || cpu->switchedOut())
+        return;
+
+    if (fault != NoFault || req->isUncacheable() || cacheBlocked ||
+        !cpu->system->isMemAddr(req->getPaddr())) {
+        DPRINTF(Fetch, "[tid:%i]: Dropping prefetch of line %#x.\n",
+                tid, req->getVaddr());
+        target->prefetch = PrefetchState::Skipped;
+        ++ftqDroppedPrefetches;
+        return;
+    }
+
+    PacketPtr pkt = Packet::createRead(req);
+    pkt->allocate();
+
+    if (!cpu->getInstPort().sendTimingReq(pkt)) {
+        // The icache retries later, fetch waits for it like for its own
+        // requests.
+        delete pkt;
+        target->prefetch = PrefetchState::Skipped;
+        cacheBlocked = true;
+        ++ftqDroppedPrefetches;
+        return;
+    }
+
+    target->prefetch = PrefetchState::Sent;
+    ++ftqPrefetches;
+}
+
+template <class Impl>
+void
+DefaultFetch<Impl>::consumeFetchTarget(ThreadID tid, Addr block_pc,
+                                       Addr fetch_addr)
+{
+    ftqFetchBlock[tid] = block_pc;
+
+    if (!ftq[tid].empty() && ftq[tid].front().blockPC == block_pc) {
+        if (ftq[tid].front().prefetch == PrefetchState::Sent)
+            ++ftqUsefulPrefetches;
+
+        ftq[tid].pop_front();
+        ++ftqHits;
+        return;
+    }
+
+    DPRINTF(Fetch, "[tid:%i]: Block %#x is not the next fetch target, "
+            "running ahead again.\n", tid, block_pc);
+
+    ++ftqMisses;
+    flushFetchTargets(tid, fetch_addr);
+}
+
+template <class Impl>
+void
+DefaultFetch<Impl>::flushFetchTargets(ThreadID tid, Addr pc)
+{
+    for (const auto &target : ftq[tid]) {
+        if (target.prefetch == PrefetchState::Sent)
+            ++ftqUselessPrefetches;
+    }
+
+    ftq[tid].clear();
+    ftqPC[tid] = pc;
+    // Fetch reads the line of the PC itself.
+    ftqPrefetchLine[tid] = pc & ~Addr(cacheBlkSize - 1);
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 inline void
 DefaultFetch<Impl>::doSquash(const TheISA::PCState &newPC,
@@ -792,6 +1090,12 @@ DefaultFetch<Impl>::doSquash(const TheISA::PCState &newPC,
     // Empty fetch queue
     fetchQueue[tid].clear();
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // Run ahead again from the new PC, whose block fetch reads next.
+    flushFetchTargets(tid, newPC.instAddr());
+    ftqFetchBlock[tid] = fetchBufferAlignPC(newPC.instAddr());
+    /// MPINHO 17-oct-2026 END ///
+
     // microops are being squashed, it is not known wheather the
     // youngest non-squashed microop was  marked delayed commit
     // or not. Setting the flag to true ensures that the
@@ -942,6 +1246,21 @@ DefaultFetch<Impl>::tick()
         }
     }
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // The branch predictor runs ahead of fetch, and the icache prefetches
+    // the blocks it predicts.
+    if (ftqSize) {
+        for (auto tid : *activeThreads) {
+            if (canRunAhead(tid)) {
+                runAhead(tid);
+                issuePrefetch(tid);
+            }
+
+            ftqOccupancy.sample(ftq[tid].size());
+        }
+    }
+    /// MPINHO 17-oct-2026 END ///
+
     // Send instructions enqueued into the fetch queue to decode.
     // Limit rate by fetchWidth.  Stall if decode is stalled.
     unsigned insts_to_decode = 0;
@@ -45,4 +45,8 @@ UnifiedFreeList::UnifiedFreeList(const std::string &_my_name,
     // Have the register file initialize the free list since it knows
     // about its internal organization
     regFile->initFreeList(this);
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    regSharers.assign(regFile->totalNumPhysRegs(), 0);
+    /// MPINHO 17-oct-2026 END ///
 }
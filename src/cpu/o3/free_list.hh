@@ -44,6 +44,7 @@
 #ifndef __CPU_O3_FREE_LIST_HH__
 #define __CPU_O3_FREE_LIST_HH__
 
+#include <cstdint> /// MPINHO 17-oct-2026 ///
 #include <iostream>
 #include <queue>
 #include <vector>
@@ -150,6 +151,14 @@ class UnifiedFreeList
      */
     PhysRegFile *regFile;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Number of rename mappings of each physical register beyond the
+     * first one, made by eliminated moves. Indexed by flat index.
+     */
+    std::vector<uint16_t> regSharers;
+    /// MPINHO 17-oct-2026 END ///
+
     /*
      * We give UnifiedRenameMap internal access so it can get at the
      * internal per-class free lists and associate those with its
@@ -219,6 +228,40 @@ class UnifiedFreeList
     /** Adds a cc register back to the free list. */
     void addCCReg(PhysRegIdPtr freed_reg) { ccList.addReg(freed_reg); }
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Records one more rename mapping of an allocated register, made by
+     * an eliminated move that reuses it as its destination.
+     */
+    void
+    shareReg(PhysRegIdPtr reg)
+    {
+        assert(regSharers[reg->flatIndex()] < UINT16_MAX);
+        ++regSharers[reg->flatIndex()];
+    }
+
+    /**
+     * Drops one rename mapping of a register. Returns true if it was the
+     * last one, so the register can go back to the free list.
+     */
+    bool
+    unshareReg(PhysRegIdPtr reg)
+    {
+        if (!regSharers[reg->flatIndex()])
+            return true;
+
+        --regSharers[reg->flatIndex()];
+        return false;
+    }
+
+    /** Whether a register has more than one rename mapping. */
+    bool
+    isShared(PhysRegIdPtr reg) const
+    {
+        return regSharers[reg->flatIndex()] != 0;
+    }
+    /// MPINHO 17-oct-2026 END ///
+
     /** Checks if there are any free integer registers. */
     bool hasFreeIntRegs() const { return intList.hasFreeRegs(); }
 
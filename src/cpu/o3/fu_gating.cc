@@ -0,0 +1,114 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+
+#include "cpu/o3/fu_gating.hh"
+
+#include "base/logging.hh"
+
+FUGatingController::FUGatingController()
+    : policy(FUGatingPolicy::Disabled),
+      idleTimeout(0),
+      gateOffLatency(0),
+      wakeUpLatency(0),
+      breakevenTH(0)
+{}
+
+void
+FUGatingController::init(int num_units, FUGatingPolicy _policy,
+                         int idle_timeout, int gate_off_latency,
+                         int wake_up_latency, int breakeven)
+{
+    if (idle_timeout < 1 || gate_off_latency < 0 || wake_up_latency < 0) {
+        fatal("Invalid FU gating latencies (timeout: %d, gate off: %d,"
+              " wake up: %d).\n",
+              idle_timeout, gate_off_latency, wake_up_latency);
+    }
+
+    units.assign(num_units, Unit());
+
+    policy = _policy;
+    idleTimeout = idle_timeout;
+    gateOffLatency = gate_off_latency;
+    wakeUpLatency = wake_up_latency;
+    breakevenTH = breakeven;
+}
+
+void
+FUGatingController::endIdlePeriod(Unit &unit)
+{
+    if (unit.idleRun) {
+        unit.predIdle = (unit.predIdle + unit.idleRun) / 2;
+        unit.idleRun = 0;
+    }
+}
+
+bool
+FUGatingController::wakeUp(int unit_idx)
+{
+    Unit &unit = units[unit_idx];
+
+    if (unit.state == On || unit.state == WakingUp)
+        return false;
+
+    endIdlePeriod(unit);
+
+    if (wakeUpLatency == 0) {
+        unit.state = On;
+    } else {
+        unit.state = WakingUp;
+        unit.counter = wakeUpLatency;
+    }
+
+    return true;
+}
+
+bool
+FUGatingController::tick(int unit_idx, bool active)
+{
+    Unit &unit = units[unit_idx];
+
+    switch (unit.state) {
+      case On:
+        if (active) {
+            endIdlePeriod(unit);
+            return false;
+        }
+
+        unit.idleRun++;
+
+        if (!enabled())
+            return false;
+
+        if (unit.idleRun >= idleTimeout ||
+            (policy == FUGatingPolicy::Predictive && unit.idleRun == 1 &&
+             unit.predIdle > breakevenTH)) {
+            if (gateOffLatency == 0) {
+                unit.state = Off;
+            } else {
+                unit.state = GatingOff;
+                unit.counter = gateOffLatency;
+            }
+            return true;
+        }
+        return false;
+
+      case GatingOff:
+        unit.idleRun++;
+        if (--unit.counter == 0)
+            unit.state = Off;
+        return false;
+
+      case Off:
+        unit.idleRun++;
+        return false;
+
+      case WakingUp:
+        if (--unit.counter == 0)
+            unit.state = On;
+        return false;
+
+      default:
+        panic("Invalid FU gating state: %d.", unit.state);
+    }
+}
+
+/// MPINHO 17-oct-2026 END ///
@@ -0,0 +1,88 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+#ifndef __CPU_O3_FU_GATING_HH__
+#define __CPU_O3_FU_GATING_HH__
+
+#include <vector>
+
+#include "enums/FUGatingPolicy.hh"
+
+/**
+ * Power-gating controller for a set of functional units.
+ *
+ * Each unit is either on, gating off (for gateOffLatency cycles), off, or
+ * waking up (for wakeUpLatency cycles). Only units that are on can issue.
+ * Idle units are gated off according to the policy:
+ *  - Timeout: after being idle for idleTimeout cycles.
+ *  - Predictive: as soon as they become idle, if the idle period predicted
+ *    for the unit (an average of its past idle periods) is longer than the
+ *    breakeven threshold; otherwise, after the timeout.
+ * A unit that is off stays off until it is woken up.
+ */
+class FUGatingController
+{
+  public:
+    /** Power state of a unit. */
+    enum State {
+        On,
+        GatingOff,
+        Off,
+        WakingUp
+    };
+
+  private:
+    /** Per unit gating state. */
+    struct Unit
+    {
+        State state;
+        /** Cycles left to finish gating off or waking up. */
+        int counter;
+        /** Length of the current idle period. */
+        int idleRun;
+        /** Predicted length of the next idle period. */
+        int predIdle;
+
+        Unit() : state(On), counter(0), idleRun(0), predIdle(0) {}
+    };
+
+    std::vector<Unit> units;
+
+    FUGatingPolicy policy;
+    int idleTimeout;
+    int gateOffLatency;
+    int wakeUpLatency;
+    int breakevenTH;
+
+    /** Ends the idle period of a unit, and trains its prediction. */
+    void endIdlePeriod(Unit &unit);
+
+  public:
+    FUGatingController();
+
+    /** Sets the number of units and the gating parameters. */
+    void init(int num_units, FUGatingPolicy _policy, int idle_timeout,
+              int gate_off_latency, int wake_up_latency, int breakeven);
+
+    /** Returns true if gating is enabled. */
+    bool enabled() const { return policy != FUGatingPolicy::Disabled; }
+
+    /** Returns the gating state of a unit. */
+    State getState(int unit) const { return units[unit].state; }
+
+    /** Returns true if a unit can issue. */
+    bool isOn(int unit) const { return units[unit].state == On; }
+
+    /**
+     * Starts waking up a unit that is off or gating off. Returns true if
+     * the unit was not already on or waking up.
+     */
+    bool wakeUp(int unit);
+
+    /**
+     * Advances the state of a unit by one cycle, given whether it was
+     * active during the cycle. Returns true if the unit started gating off.
+     */
+    bool tick(int unit, bool active);
+};
+
+#endif // __CPU_O3_FU_GATING_HH__
+/// MPINHO 17-oct-2026 END ///
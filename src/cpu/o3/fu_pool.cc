@@ -42,10 +42,12 @@
 
 #include "cpu/o3/fu_pool.hh"
 
+#include <algorithm> /// MPINHO 17-oct-2026 ///
 #include <sstream>
 
 #include "cpu/func_unit.hh"
 #include "debug/FU.hh"
+#include "debug/FUGating.hh" /// MPINHO 17-oct-2026 ///
 #include "debug/FUIdle.hh"
 
 using namespace std;
@@ -85,13 +87,15 @@ FUPool::~FUPool()
 // Constructor
 FUPool::FUPool(const Params *p)
     : SimObject(p),
-      breakevenTH(p->breakevenThreshold)
+      breakevenTH(p->breakevenThreshold),
+      steeringPolicy(p->steeringPolicy) /// MPINHO 17-oct-2026 ///
 {
     numFU = 0;
     numFPFU = 0;
     numSimdFU = 0;
     simdIssueCap = 0;
     simdWidthCap = 0;
+    maxIssueCap = 1;
 
     funcUnits.clear();
 
@@ -143,6 +147,8 @@ FUPool::FUPool(const Params *p)
             int newWidthCap = (*i)->widthCap;
             fu->setIssueCap(newIssueCap);
             fu->setWidthCap(newWidthCap);
+            if (newIssueCap > maxIssueCap)
+                maxIssueCap = newIssueCap;
             if ((*i)->simd) {
                 if (newIssueCap > simdIssueCap)
                     simdIssueCap = newIssueCap;
@@ -158,6 +164,10 @@ FUPool::FUPool(const Params *p)
 
             //  Add the appropriate number of copies of this FU to the list
             fu->name = (*i)->name() + "(0)";
+            /// MPINHO 17-oct-2026 BEGIN ///
+            fuSimdIdx.push_back((*i)->simd ? simdFUIdx.size() : -1);
+            if ((*i)->simd) simdFUIdx.push_back(funcUnits.size());
+            /// MPINHO 17-oct-2026 END ///
             funcUnits.push_back(fu);
 
             for (int c = 1; c < (*i)->number; ++c) {
@@ -169,12 +179,17 @@ FUPool::FUPool(const Params *p)
 
                 s << (*i)->name() << "(" << c << ")";
                 fu2->name = s.str();
+                /// MPINHO 17-oct-2026 BEGIN ///
+                fuSimdIdx.push_back((*i)->simd ? simdFUIdx.size() : -1);
+                if ((*i)->simd) simdFUIdx.push_back(funcUnits.size());
+                /// MPINHO 17-oct-2026 END ///
                 funcUnits.push_back(fu2);
             }
         }
     }
 
     unitBusy.resize(numFU);
+    fuPacking.resize(numFU); /// MPINHO 17-oct-2026 ///
 
     for (int i = 0; i < numFU; i++) {
         unitBusy[i] = false;
@@ -188,6 +203,11 @@ FUPool::FUPool(const Params *p)
     }
     /// MPINHO 23-oct-2019 END ///
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    simdGating.init(numSimdFU, p->gatingPolicy, p->gatingIdleTimeout,
+                    p->gateOffLatency, p->wakeUpLatency, breakevenTH);
+    /// MPINHO 17-oct-2026 END ///
+
 }
 
 /// MPINHO 23-aug-2019 BEGIN ///
@@ -247,6 +267,69 @@ FUPool::regStats()
         .desc("Counters for idle SIMD FU periods over the breakeven "
               "threshold")
         ;
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    statGatingCycles
+        .name(name() + ".gating_cycles")
+        .desc("Cycles with the FU gating state updated")
+        ;
+    statSimdGatedCycles
+        .init(numSimdFU)
+        .name(name() + ".simd_gated_cycles")
+        .desc("Cycles each Simd FU was powered off")
+        .flags(Stats::total)
+        ;
+    statSimdOnCycles
+        .name(name() + ".simd_on_cycles")
+        .desc("Simd FU cycles powered on, gating off or waking up")
+        ;
+    statSimdGateEvents
+        .name(name() + ".simd_gate_events")
+        .desc("Number of times a Simd FU started gating off")
+        ;
+    statSimdWakeUps
+        .name(name() + ".simd_wake_ups")
+        .desc("Number of times a Simd FU was woken up")
+        ;
+    statSimdGatedStalls
+        .name(name() + ".simd_gated_stalls")
+        .desc("Number of FU requests denied because the free FUs were"
+              " powered off")
+        ;
+    statSimdLeakageProxy
+        .name(name() + ".simd_leakage_proxy")
+        .desc("Simd FU leakage energy proxy, in FU cycles: cycles powered"
+              " on plus the breakeven cost of each gating event")
+        ;
+    statSimdLeakageProxy = statSimdOnCycles +
+        statSimdGateEvents * Stats::constant(breakevenTH);
+    statSimdLeakageNorm
+        .name(name() + ".simd_leakage_norm")
+        .desc("Simd FU leakage energy proxy relative to no gating")
+        ;
+    statSimdLeakageNorm = statSimdLeakageProxy /
+        (statGatingCycles * Stats::constant(numSimdFU));
+    statSimdIdlePeriod
+        .init(1, std::max(2, 4 * breakevenTH), std::max(1, breakevenTH / 5))
+        .name(name() + ".simd_idle_period")
+        .desc("dist of the length of the idle periods of the Simd FUs")
+        ;
+    statSimdIdleOverBreakeven
+        .name(name() + ".simd_idle_over_breakeven")
+        .desc("Number of Simd FU idle periods over the breakeven threshold")
+        ;
+    statSimdIdleOverBreakevenNorm
+        .name(name() + ".simd_idle_over_breakeven_norm")
+        .desc("Fraction of Simd FU idle periods over the breakeven"
+              " threshold")
+        ;
+    statSimdIdlePeriods
+        .name(name() + ".simd_idle_periods")
+        .desc("Number of Simd FU idle periods")
+        ;
+    statSimdIdleOverBreakevenNorm = statSimdIdleOverBreakeven /
+        statSimdIdlePeriods;
+    /// MPINHO 17-oct-2026 END ///
 }
 /// MPINHO 23-aug-2019 END ///
 
@@ -258,14 +341,38 @@ FUPool::getUnit(OpClass capability)
     if (!capabilityList[capability])
         return -2;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (steeringPolicy == FUSteeringPolicy::Consolidate)
+        return getFirstUnit(capability);
+    /// MPINHO 17-oct-2026 END ///
+
     int fu_idx = fuPerCapList[capability].getFU();
     int start_idx = fu_idx;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // Free FU that is powered off, to wake up if no other one is free.
+    int gated_idx = -1;
+    bool waking = false;
+    /// MPINHO 17-oct-2026 END ///
+
     // Iterate through the circular queue if needed, stopping if we've reached
     // the first element again.
-    while (unitBusy[fu_idx]) {
+    while (unitBusy[fu_idx] || isFUGated(fu_idx)) { /// MPINHO 17-oct-2026 ///
+        /// MPINHO 17-oct-2026 BEGIN ///
+        if (!unitBusy[fu_idx]) {
+            if (simdGating.getState(fuSimdIdx[fu_idx]) ==
+                FUGatingController::WakingUp) {
+                waking = true;
+            } else if (gated_idx < 0) {
+                gated_idx = fu_idx;
+            }
+        }
+        /// MPINHO 17-oct-2026 END ///
         fu_idx = fuPerCapList[capability].getFU();
         if (fu_idx == start_idx) {
+            /// MPINHO 17-oct-2026 BEGIN ///
+            gatedStall(gated_idx, waking);
+            /// MPINHO 17-oct-2026 END ///
             // No FU available
             return -1;
         }
@@ -278,6 +385,80 @@ FUPool::getUnit(OpClass capability)
     return fu_idx;
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+void
+FUPool::gatedStall(int gated_idx, bool waking)
+{
+    if (gated_idx < 0 && !waking)
+        return;
+
+    ++statSimdGatedStalls;
+
+    // Only one FU is woken up at a time for each request.
+    if (!waking && simdGating.wakeUp(fuSimdIdx[gated_idx])) {
+        ++statSimdWakeUps;
+        DPRINTF(FUGating, "Waking up %s.\n", funcUnits[gated_idx]->name);
+    }
+}
+
+int
+FUPool::getFirstUnit(OpClass capability)
+{
+    const FUIdxQueue &fus = fuPerCapList[capability];
+
+    int gated_idx = -1;
+    bool waking = false;
+
+    for (int n = 0; n < fus.numFU(); n++) {
+        int fu_idx = fus.getFUAt(n);
+
+        if (unitBusy[fu_idx])
+            continue;
+
+        if (isFUGated(fu_idx)) {
+            if (simdGating.getState(fuSimdIdx[fu_idx]) ==
+                FUGatingController::WakingUp) {
+                waking = true;
+            } else if (gated_idx < 0) {
+                gated_idx = fu_idx;
+            }
+            continue;
+        }
+
+        unitBusy[fu_idx] = true;
+
+        return fu_idx;
+    }
+
+    gatedStall(gated_idx, waking);
+
+    // No FU available
+    return -1;
+}
+
+void
+FUPool::updateGating()
+{
+    ++statGatingCycles;
+
+    for (int i = 0; i < numSimdFU; i++) {
+        int fu_idx = simdFUIdx[i];
+        bool active = unitBusy[fu_idx] ||
+                      funcUnits[fu_idx]->getUsedIssueCap() > 0;
+
+        if (simdGating.tick(i, active)) {
+            ++statSimdGateEvents;
+            DPRINTF(FUGating, "Gating off %s.\n", funcUnits[fu_idx]->name);
+        }
+
+        if (simdGating.getState(i) == FUGatingController::Off)
+            statSimdGatedCycles[i]++;
+        else
+            ++statSimdOnCycles;
+    }
+}
+/// MPINHO 17-oct-2026 END ///
+
 void
 FUPool::freeUnitNextCycle(int fu_idx)
 {
@@ -371,6 +552,7 @@ FUPool::resetFUCaps()
         if (!unitBusy[i]) {
             funcUnits[i]->resetIssueCap();
             funcUnits[i]->resetWidthCap();
+            fuPacking[i].reset(); /// MPINHO 17-oct-2026 ///
         }
     }
 }
@@ -438,6 +620,14 @@ FUPool::updateStats()
 
     // Update Simd FUs idle counters.
     for (int i = 0; i < usedSimd; i++) {
+        /// MPINHO 17-oct-2026 BEGIN ///
+        if (simdIdle[i]) {
+            statSimdIdlePeriod.sample(simdIdle[i]);
+            ++statSimdIdlePeriods;
+            if (simdIdle[i] > breakevenTH)
+                ++statSimdIdleOverBreakeven;
+        }
+        /// MPINHO 17-oct-2026 END ///
         // Reset idle counter.
         simdIdle[i] = 0;
     }
@@ -460,9 +650,22 @@ FUPool::updateStats()
                 ss_counters.str(),
                 ss_total.str());
     }
+
+    updateGating(); /// MPINHO 17-oct-2026 ///
 }
 /// MPINHO 13-aug-2019 END ///
 
+/// MPINHO 17-oct-2026 BEGIN ///
+void
+FUPool::skipCycles(Cycles cycles)
+{
+    // Busy FUs stay busy and no FU issues, so each cycle is sampled the
+    // same, and idle FUs keep gating off.
+    for (Cycles i(0); i < cycles; ++i)
+        updateStats();
+}
+/// MPINHO 17-oct-2026 END ///
+
 bool
 FUPool::isDrained() const
 {
@@ -51,7 +51,10 @@
 #include <vector>
 
 #include "base/statistics.hh"
+#include "base/types.hh" /// MPINHO 17-oct-2026 ///
+#include "cpu/o3/fu_gating.hh" /// MPINHO 17-oct-2026 ///
 #include "cpu/op_class.hh"
+#include "cpu/packing_criteria.hh" /// MPINHO 17-oct-2026 ///
 #include "params/FUPool.hh"
 #include "sim/sim_object.hh"
 
@@ -108,6 +111,14 @@ class FUPool : public SimObject
          */
         inline int getFU();
 
+        /// MPINHO 17-oct-2026 BEGIN ///
+        /** Returns the number of FUs in the queue. */
+        int numFU() const { return size; }
+
+        /** Returns the index of the n-th FU, in the order they were added. */
+        int getFUAt(int n) const { return funcUnitsIdx[n]; }
+        /// MPINHO 17-oct-2026 END ///
+
       private:
         /** Circular queue index. */
         int idx;
@@ -130,10 +141,52 @@ class FUPool : public SimObject
     int numFPFU;
     int numSimdFU;
     int simdIssueCap, simdWidthCap;
+    /** Largest issue capability of any FU. */
+    int maxIssueCap;
     int breakevenTH;
     std::vector<int> simdIdle;
     /// MPINHO 23-aug-2019 END ///
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Instructions packed in each FU during the current cycle. */
+    std::vector<PackingSlot> fuPacking;
+
+    /** Power-gating controller of the SIMD FUs. */
+    FUGatingController simdGating;
+    /** FU index of each SIMD FU. */
+    std::vector<int> simdFUIdx;
+    /** SIMD FU number of each FU, or -1 if not SIMD. */
+    std::vector<int> fuSimdIdx;
+
+    /** Returns true if a FU is powered off (or not yet powered on). */
+    bool
+    isFUGated(int fu_idx) const
+    {
+        return fuSimdIdx[fu_idx] >= 0 && !simdGating.isOn(fuSimdIdx[fu_idx]);
+    }
+
+    /**
+     * Records a FU request denied because the free FUs are powered off,
+     * and wakes up one of them (gated_idx) unless one is already waking up.
+     */
+    void gatedStall(int gated_idx, bool waking);
+
+    /**
+     * Advances the gating state of the SIMD FUs (to call each cycle).
+     */
+    void updateGating();
+
+    /** Policy to choose a free FU. */
+    FUSteeringPolicy steeringPolicy;
+
+    /**
+     * Gets a free FU, powered on, providing the requested capability. The
+     * first one in the order the FUs were added is taken, so the work is
+     * consolidated in as few FUs as possible.
+     */
+    int getFirstUnit(OpClass capability);
+    /// MPINHO 17-oct-2026 END ///
+
     /** Functional units. */
     std::vector<FuncUnit *> funcUnits;
 
@@ -154,6 +207,36 @@ class FUPool : public SimObject
     Stats::Vector totalSimdIdle;
     /// MPINHO 23-aug-2019 END ///
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Cycles with the gating state updated. */
+    Stats::Scalar statGatingCycles;
+    /** Cycles each SIMD FU was powered off. */
+    Stats::Vector statSimdGatedCycles;
+    /** SIMD FU cycles powered on (or gating off, or waking up). */
+    Stats::Scalar statSimdOnCycles;
+    /** Number of times a SIMD FU started gating off. */
+    Stats::Scalar statSimdGateEvents;
+    /** Number of times a SIMD FU was woken up. */
+    Stats::Scalar statSimdWakeUps;
+    /** Number of FU requests denied because the free FUs were gated. */
+    Stats::Scalar statSimdGatedStalls;
+    /**
+     * Leakage energy proxy of the SIMD FUs, in FU cycles powered on:
+     * cycles on, plus the breakeven cost of each gating event.
+     */
+    Stats::Formula statSimdLeakageProxy;
+    /** Leakage energy proxy relative to never gating the SIMD FUs. */
+    Stats::Formula statSimdLeakageNorm;
+    /** Length of the idle periods of the SIMD FUs. */
+    Stats::Distribution statSimdIdlePeriod;
+    /** Number of SIMD FU idle periods. */
+    Stats::Scalar statSimdIdlePeriods;
+    /** Number of SIMD FU idle periods over the breakeven threshold. */
+    Stats::Scalar statSimdIdleOverBreakeven;
+    /** Fraction of SIMD FU idle periods over the breakeven threshold. */
+    Stats::Formula statSimdIdleOverBreakevenNorm;
+    /// MPINHO 17-oct-2026 END ///
+
 
   public:
     typedef FUPoolParams Params;
@@ -209,6 +292,9 @@ class FUPool : public SimObject
     /** Returns the current issue capability of a given FU. */
     unsigned getFUIssueCap(int fu_idx);
 
+    /** Returns the largest issue capability of any FU in the pool. */
+    int getMaxIssueCap() { return maxIssueCap; }
+
     /** Depletes the issue capability of a given FU. */
     void useFUIssueCap(int fu_idx);
 
@@ -221,6 +307,18 @@ class FUPool : public SimObject
     /** Reset FUs caps, for non-busy FUs. */
     void resetFUCaps();
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Returns the packing state of a given FU. */
+    PackingSlot &getFUPacking(int fu_idx) { return fuPacking[fu_idx]; }
+
+    /**
+     * Should fuseable insts be packed into the FUs already issuing in the
+     * cycle before a free FU is taken?
+     */
+    bool consolidates() const
+    { return steeringPolicy == FUSteeringPolicy::Consolidate; }
+    /// MPINHO 17-oct-2026 END ///
+
     /** Checks whether a giver FU has a capability. */
     bool hasCapability(int fu_idx, OpClass capability);
 
@@ -228,6 +326,14 @@ class FUPool : public SimObject
     void updateStats();
     /// MPINHO 22-aug-2019 END ///
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Updates the stats and gating state for cycles not ticked by the CPU,
+     * in which the FUs did not change, as updateStats() on each of them.
+     */
+    void skipCycles(Cycles cycles);
+    /// MPINHO 17-oct-2026 END ///
+
     /** Have all the FUs drained? */
     bool isDrained() const;
 
@@ -51,6 +51,7 @@
 #include "cpu/o3/lsq.hh"
 #include "cpu/o3/scoreboard.hh"
 #include "cpu/timebuf.hh"
+#include "cpu/width_board.hh" /// MPINHO 17-oct-2026
 #include "debug/IEW.hh"
 #include "sim/probe/probe.hh"
 
@@ -165,12 +166,25 @@ class DefaultIEW
     /** Sets pointer to the scoreboard. */
     void setScoreboard(Scoreboard *sb_ptr);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Sets pointer to the precision board. */
+    void setPrecisionBoard(PrecisionBoard *pb_ptr);
+    /// MPINHO 17-oct-2026 END ///
+
     /** Perform sanity checks after a drain. */
     void drainSanityCheck() const;
 
     /** Has the stage drained? */
     bool isDrained() const;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Is IEW only waiting for FU completions or memory responses? */
+    bool isQuiescent();
+
+    /** Accounts for cycles not ticked while the pipeline was quiescent. */
+    void skipCycles(Cycles cycles);
+    /// MPINHO 17-oct-2026 END ///
+
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
@@ -235,6 +249,19 @@ class DefaultIEW
     /** Check misprediction  */
     void checkMisprediction(const DynInstPtr &inst);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Wakes the dependents of a load whose value has been predicted, and
+     * marks its destination as ready.
+     */
+    void wakeValuePredicted(const DynInstPtr &inst);
+
+    /** Squashes the instructions younger than a load whose value was
+     *  mispredicted.
+     */
+    void checkValueMisprediction(const DynInstPtr &inst);
+    /// MPINHO 17-oct-2026 END ///
+
   private:
     /** Sends commit proper information for a squash due to a branch
      * mispredict.
@@ -246,6 +273,13 @@ class DefaultIEW
      */
     void squashDueToMemOrder(const DynInstPtr &inst, ThreadID tid);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Sends commit proper information for a squash due to a load value
+     * misprediction.
+     */
+    void squashDueToValueMispred(const DynInstPtr &inst, ThreadID tid);
+    /// MPINHO 17-oct-2026 END ///
+
     /** Sets Dispatch to blocked, and signals back to other stages to block. */
     void block(ThreadID tid);
 
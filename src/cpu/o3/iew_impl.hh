@@ -391,6 +391,15 @@ DefaultIEW<Impl>::setScoreboard(Scoreboard *sb_ptr)
     scoreboard = sb_ptr;
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template<class Impl>
+void
+DefaultIEW<Impl>::setPrecisionBoard(PrecisionBoard *pb_ptr)
+{
+    instQueue.setPrecisionBoard(pb_ptr);
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 bool
 DefaultIEW<Impl>::isDrained() const
@@ -420,6 +429,24 @@ DefaultIEW<Impl>::isDrained() const
     return drained;
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+bool
+DefaultIEW<Impl>::isQuiescent()
+{
+    // FU completions, load responses and cache retries wake the CPU up,
+    // but stores ready to be written back are sent on the next tick.
+    return instQueue.isQuiescent() && !ldstQueue.willWB();
+}
+
+template <class Impl>
+void
+DefaultIEW<Impl>::skipCycles(Cycles cycles)
+{
+    fuPool->skipCycles(cycles);
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 void
 DefaultIEW<Impl>::drainSanityCheck() const
@@ -485,6 +512,10 @@ DefaultIEW<Impl>::squash(ThreadID tid)
         }
 
         toRename->iewInfo[tid].dispatched++;
+        /// MPINHO 17-oct-2026 BEGIN ///
+        if (skidBuffer[tid].front()->fusedTail)
+            toRename->iewInfo[tid].dispatchedFused++;
+        /// MPINHO 17-oct-2026 END ///
 
         skidBuffer[tid].pop();
     }
@@ -544,6 +575,35 @@ DefaultIEW<Impl>::squashDueToMemOrder(const DynInstPtr& inst, ThreadID tid)
     }
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template<class Impl>
+void
+DefaultIEW<Impl>::squashDueToValueMispred(const DynInstPtr &inst,
+                                          ThreadID tid)
+{
+    DPRINTF(IEW, "[tid:%i]: Load value mispredicted, squashing younger "
+            "insts, PC: %s [sn:%i].\n", tid, inst->pcState(), inst->seqNum);
+
+    // The load itself has the right value by now, so only the younger
+    // instructions are squashed and fetch resumes after the load.
+    if (!toCommit->squash[tid] ||
+            inst->seqNum < toCommit->squashedSeqNum[tid]) {
+        toCommit->squash[tid] = true;
+        toCommit->squashedSeqNum[tid] = inst->seqNum;
+        toCommit->branchTaken[tid] = false;
+
+        TheISA::PCState pc = inst->pcState();
+        TheISA::advancePC(pc, inst->staticInst);
+
+        toCommit->pc[tid] = pc;
+        toCommit->mispredictInst[tid] = NULL;
+        toCommit->includeSquashInst[tid] = false;
+
+        wroteToTimeBuffer = true;
+    }
+}
+/// MPINHO 17-oct-2026 END ///
+
 template<class Impl>
 void
 DefaultIEW<Impl>::block(ThreadID tid)
@@ -587,6 +647,27 @@ DefaultIEW<Impl>::wakeDependents(const DynInstPtr& inst)
     instQueue.wakeDependents(inst);
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template<class Impl>
+void
+DefaultIEW<Impl>::wakeValuePredicted(const DynInstPtr &inst)
+{
+    int dependents = instQueue.wakeRegDependents(inst);
+
+    for (int i = 0; i < inst->numDestRegs(); i++) {
+        DPRINTF(IEW, "Setting predicted Destination Register %i (%s)\n",
+                inst->renamedDestRegIdx(i)->index(),
+                inst->renamedDestRegIdx(i)->className());
+        scoreboard->setReg(inst->renamedDestRegIdx(i));
+    }
+
+    if (dependents) {
+        producerInst[inst->threadNumber]++;
+        consumerInst[inst->threadNumber] += dependents;
+    }
+}
+/// MPINHO 17-oct-2026 END ///
+
 template<class Impl>
 void
 DefaultIEW<Impl>::rescheduleMemInst(const DynInstPtr& inst)
@@ -869,6 +950,10 @@ DefaultIEW<Impl>::emptyRenameInsts(ThreadID tid)
         }
 
         toRename->iewInfo[tid].dispatched++;
+        /// MPINHO 17-oct-2026 BEGIN ///
+        if (insts[tid].front()->fusedTail)
+            toRename->iewInfo[tid].dispatchedFused++;
+        /// MPINHO 17-oct-2026 END ///
 
         insts[tid].pop();
     }
@@ -968,13 +1053,18 @@ DefaultIEW<Impl>::dispatchInsts(ThreadID tid)
     DynInstPtr inst;
     bool add_to_iq = false;
     int dis_num_inst = 0;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // The tail of a fused pair does not take a dispatch slot of its own,
+    // as rename sends it on top of its width.
+    int fused_insts = 0;
 
     // Loop through the instructions, putting them in the instruction
     // queue.
     for ( ; dis_num_inst < insts_to_add &&
-              dis_num_inst < dispatchWidth;
+              dis_num_inst - fused_insts < dispatchWidth;
           ++dis_num_inst)
     {
+    /// MPINHO 17-oct-2026 END ///
         inst = insts_to_dispatch.front();
 
         if (dispatchStatus[tid] == Unblocking) {
@@ -1011,12 +1101,19 @@ DefaultIEW<Impl>::dispatchInsts(ThreadID tid)
             }
 
             toRename->iewInfo[tid].dispatched++;
+            /// MPINHO 17-oct-2026 BEGIN ///
+            if (inst->fusedTail)
+                toRename->iewInfo[tid].dispatchedFused++;
+            /// MPINHO 17-oct-2026 END ///
 
             continue;
         }
 
         // Check for full conditions.
-        if (instQueue.isFull(tid)) {
+        /// MPINHO 17-oct-2026 BEGIN ///
+        // The tail of a fused pair goes into the entry of its head.
+        if (instQueue.isFull(tid) && !inst->fusedTail) {
+        /// MPINHO 17-oct-2026 END ///
             DPRINTF(IEW, "[tid:%i]: Issue: IQ has become full.\n", tid);
 
             // Call function to start blocking.
@@ -1050,6 +1147,11 @@ DefaultIEW<Impl>::dispatchInsts(ThreadID tid)
             break;
         }
 
+        /// MPINHO 17-oct-2026 BEGIN ///
+        if (inst->fusedTail)
+            ++fused_insts;
+        /// MPINHO 17-oct-2026 END ///
+
         // Otherwise issue the instruction just fine.
         if (inst->isAtomic()) {
             DPRINTF(IEW, "[tid:%i]: Issue: Memory instruction "
@@ -1110,6 +1212,19 @@ DefaultIEW<Impl>::dispatchInsts(ThreadID tid)
             inst->setCanCommit();
             instQueue.insertBarrier(inst);
             add_to_iq = false;
+        /// MPINHO 17-oct-2026 BEGIN ///
+        } else if (inst->moveEliminated) {
+            // The destination already holds the result, so the instruction
+            // is done. Its dependents wait on the producer of the source.
+            DPRINTF(IEW, "[tid:%i]: Issue: Move eliminated at rename, "
+                    "skipping.\n", tid);
+
+            inst->setIssued();
+            inst->setExecuted();
+            inst->setCanCommit();
+
+            add_to_iq = false;
+        /// MPINHO 17-oct-2026 END ///
         } else if (inst->isNop()) {
             DPRINTF(IEW, "[tid:%i]: Issue: Nop instruction encountered, "
                     "skipping.\n", tid);
@@ -1152,6 +1267,10 @@ DefaultIEW<Impl>::dispatchInsts(ThreadID tid)
         insts_to_dispatch.pop();
 
         toRename->iewInfo[tid].dispatched++;
+        /// MPINHO 17-oct-2026 BEGIN ///
+        if (inst->fusedTail)
+            toRename->iewInfo[tid].dispatchedFused++;
+        /// MPINHO 17-oct-2026 END ///
 
         ++iewDispatchedInsts;
 
@@ -1470,6 +1589,12 @@ DefaultIEW<Impl>::writebackInsts()
         // are first sent to commit.  Instead commit must tell the LSQ
         // when it's ready to execute the strictly ordered load.
         if (!inst->isSquashed() && inst->isExecuted() && inst->getFault() == NoFault) {
+            /// MPINHO 17-oct-2026 BEGIN ///
+            // Record the width of the results before the dependents are
+            // woken up, so they can find it in the precision board.
+            instQueue.writebackWidth(inst);
+            /// MPINHO 17-oct-2026 END ///
+
             int dependents = instQueue.wakeDependents(inst);
 
             for (int i = 0; i < inst->numDestRegs(); i++) {
@@ -1682,4 +1807,22 @@ DefaultIEW<Impl>::checkMisprediction(const DynInstPtr& inst)
     }
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+void
+DefaultIEW<Impl>::checkValueMisprediction(const DynInstPtr &inst)
+{
+    ThreadID tid = inst->threadNumber;
+
+    if (!fetchRedirect[tid] ||
+        !toCommit->squash[tid] ||
+        toCommit->squashedSeqNum[tid] > inst->seqNum) {
+        fetchRedirect[tid] = true;
+
+        DPRINTF(IEW, "Execute: Load value mispredict detected.\n");
+        squashDueToValueMispred(inst, tid);
+    }
+}
+/// MPINHO 17-oct-2026 END ///
+
 #endif//__CPU_O3_IEW_IMPL_IMPL_HH__
@@ -31,7 +31,10 @@
 #ifndef __CPU_O3_IMPL_HH__
 #define __CPU_O3_IMPL_HH__
 
+#include <list> /// MPINHO 17-oct-2026 ///
+
 #include "arch/isa_traits.hh"
+#include "base/pool_alloc.hh" /// MPINHO 17-oct-2026 ///
 #include "config/the_isa.hh"
 #include "cpu/o3/cpu_policy.hh"
 
@@ -67,6 +70,13 @@ struct O3CPUImpl
     typedef RefCountingPtr<DynInst> DynInstPtr;
     typedef RefCountingPtr<const DynInst> DynInstConstPtr;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** List of DynInstPtr used by the CPU and its stages. Its nodes are
+     *  recycled through a pool, as instructions flow through every list.
+     */
+    typedef std::list<DynInstPtr, PoolAllocator<DynInstPtr> > DynInstList;
+    /// MPINHO 17-oct-2026 END ///
+
     /** The O3CPU type to be used. */
     typedef FullO3CPU<O3CPUImpl> O3CPU;
 
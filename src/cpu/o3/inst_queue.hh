@@ -44,20 +44,23 @@
 #ifndef __CPU_O3_INST_QUEUE_HH__
 #define __CPU_O3_INST_QUEUE_HH__
 
+#include <array> /// MPINHO 17-oct-2026 ///
 #include <list>
 #include <map>
 #include <queue>
+#include <utility> /// MPINHO 17-oct-2026 ///
 #include <vector>
 
+#include "base/bitfield.hh" /// MPINHO 17-oct-2026 ///
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/o3/dep_graph.hh"
 #include "cpu/op_class.hh"
 #include "cpu/timebuf.hh"
+#include "cpu/width_decoder.hh" /// MPINHO 12-aug-2019 ///
 #include "enums/SMTQueuePolicy.hh"
 #include "sim/eventq.hh"
-#include "width_decoder.hh" /// MPINHO 12-aug-2019 ///
 
 struct DerivO3CPUParams;
 class FUPool;
@@ -97,7 +100,10 @@ class InstructionQueue
     typedef typename Impl::CPUPol::TimeStruct TimeStruct;
 
     // Typedef of iterator through the list of instructions.
-    typedef typename std::list<DynInstPtr>::iterator ListIt;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    typedef typename Impl::DynInstList DynInstList;
+    typedef typename DynInstList::iterator ListIt;
+    /// MPINHO 17-oct-2026 END ///
 
     /** FU completion event class. */
     class FUCompletion : public Event {
@@ -153,6 +159,11 @@ class InstructionQueue
     /** Determine if we are drained. */
     bool isDrained() const;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Is there nothing to issue or retry on the next tick? */
+    bool isQuiescent() const;
+    /// MPINHO 17-oct-2026 END ///
+
     /** Perform sanity checks after a drain. */
     void drainSanityCheck() const;
 
@@ -234,6 +245,21 @@ class InstructionQueue
     /** Wakes all dependents of a completed instruction. */
     int wakeDependents(const DynInstPtr &completed_inst);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Wakes the instructions waiting on the destination registers of an
+     * instruction, without completing it. Used when the value of a load is
+     * predicted before its access completes.
+     */
+    int wakeRegDependents(const DynInstPtr &completed_inst);
+
+    /** Sets pointer to the precision board. */
+    void setPrecisionBoard(PrecisionBoard *pb_ptr);
+
+    /** Records the width of the results of a completed instruction. */
+    void writebackWidth(const DynInstPtr &completed_inst);
+    /// MPINHO 17-oct-2026 END ///
+
     /** Adds a ready memory instruction to the ready list. */
     void addReadyMemInst(const DynInstPtr &ready_inst);
 
@@ -322,23 +348,23 @@ class InstructionQueue
     //////////////////////////////////////
 
     /** List of all the instructions in the IQ (some of which may be issued). */
-    std::list<DynInstPtr> instList[Impl::MaxThreads];
+    DynInstList instList[Impl::MaxThreads]; /// MPINHO 17-oct-2026 ///
 
     /** List of instructions that are ready to be executed. */
-    std::list<DynInstPtr> instsToExecute;
+    DynInstList instsToExecute; /// MPINHO 17-oct-2026 ///
 
     /** List of instructions waiting for their DTB translation to
      *  complete (hw page table walk in progress).
      */
-    std::list<DynInstPtr> deferredMemInsts;
+    DynInstList deferredMemInsts; /// MPINHO 17-oct-2026 ///
 
     /** List of instructions that have been cache blocked. */
-    std::list<DynInstPtr> blockedMemInsts;
+    DynInstList blockedMemInsts; /// MPINHO 17-oct-2026 ///
 
     /** List of instructions that were cache blocked, but a retry has been seen
      * since, so they can now be retried. May fail again go on the blocked list.
      */
-    std::list<DynInstPtr> retryMemInsts;
+    DynInstList retryMemInsts; /// MPINHO 17-oct-2026 ///
 
     /**
      * Struct for comparing entries to be added to the priority queue.
@@ -373,39 +399,40 @@ class InstructionQueue
 
     typedef typename std::map<InstSeqNum, DynInstPtr>::iterator NonSpecMapIt;
 
-    /** Entry for the list age ordering by op class. */
-    struct ListOrderEntry {
-        OpClass queueType;
-        InstSeqNum oldestInst;
-    };
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Bit mask with one bit per op class. */
+    typedef uint64_t OpClassMask;
+    static_assert(Num_OpClasses <= 64, "Too many op classes for the mask");
 
-    /** List that contains the age order of the oldest instruction of each
-     *  ready queue.  Used to select the oldest instruction available
-     *  among op classes.
-     *  @todo: Might be better to just move these entries around instead
-     *  of creating new ones every time the position changes due to an
-     *  instruction issuing.  Not sure std::list supports this.
-     */
-    std::list<ListOrderEntry> listOrder;
+    /** Returns the bit of an op class in an op class mask. */
+    static OpClassMask
+    opClassBit(OpClass op_class)
+    {
+        return OpClassMask(1) << op_class;
+    }
 
-    typedef typename std::list<ListOrderEntry>::iterator ListOrderIt;
+    /**
+     * Op classes with ready instructions. Together with the sequence
+     * number of the oldest ready instruction of each op class, it gives the
+     * age order of the ready queues without keeping a sorted list.
+     */
+    OpClassMask readyClasses;
 
-    /** Tracks if each ready queue is on the age order list. */
-    bool queueOnList[Num_OpClasses];
+    /** Sequence number of the oldest ready instruction of each op class. */
+    std::array<InstSeqNum, Num_OpClasses> readyHead;
 
-    /** Iterators of each ready queue.  Points to their spot in the age order
-     *  list.
+    /**
+     * Updates the ready op classes and their oldest instruction after the
+     * ready queue of an op class changed.
      */
-    ListOrderIt readyIt[Num_OpClasses];
-
-    /** Add an op class to the age order list. */
-    void addToOrderList(OpClass op_class);
+    void updateReadyClass(OpClass op_class);
 
     /**
-     * Called when the oldest instruction has been removed from a ready queue;
-     * this places that ready queue into the proper spot in the age order list.
+     * Returns the op class with the oldest ready instruction, out of the
+     * ready op classes not in the skip mask, or -1 if there is none.
      */
-    void moveToYoungerInst(ListOrderIt age_order_it);
+    int oldestReadyClass(OpClassMask skip) const;
+    /// MPINHO 17-oct-2026 END ///
 
     DependencyGraph<DynInstPtr> dependGraph;
 
@@ -448,6 +475,34 @@ class InstructionQueue
      */
     Cycles commitToIEWDelay;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Maximum number of cycles a fuseable instruction is held back, waiting
+     * for a partner predicted to fuse with it. Zero disables hold-back.
+     */
+    unsigned widthHoldBackCycles;
+
+    /**
+     * Non-ready instructions with a predicted width, the candidate fuse
+     * partners of held back instructions. Gathered at most once per thread
+     * and cycle, when a hold-back is first considered.
+     */
+    std::vector<DynInstPtr> fusePartners[Impl::MaxThreads];
+
+    /** Are the fuse partners of a thread gathered in this cycle? */
+    bool fusePartnersValid[Impl::MaxThreads];
+
+    /**
+     * FUs that issued a fuseable inst in this cycle, with that inst, when
+     * the FU pool consolidates. Later insts are packed into them before a
+     * free FU is taken.
+     */
+    std::vector<std::pair<int, DynInstPtr>> packingUnits;
+
+    /** Depth beyond which a dependence chain is assumed to reach. */
+    static constexpr int MaxWaitDepth = 8;
+    /// MPINHO 17-oct-2026 END ///
+
     /** The sequence number of the squashed instruction. */
     InstSeqNum squashedSeqNum[Impl::MaxThreads];
 
@@ -468,6 +523,38 @@ class InstructionQueue
     /** Moves an instruction to the ready queue if it is ready. */
     void addIfReady(const DynInstPtr &inst);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Returns true if a ready fuseable instruction should wait one more
+     * cycle for a non-ready instruction predicted to fuse with it.
+     */
+    bool holdBackForFuse(const DynInstPtr &inst);
+
+    /**
+     * Returns true if consumer waits, directly or through other waiting
+     * instructions, on a result of producer.
+     */
+    bool waitsOn(const DynInstPtr &consumer, const DynInstPtr &producer,
+                 int depth = 0);
+
+    /**
+     * Returns a FU that already issued a fuseable inst in this cycle and
+     * can pack inst with it, or -1 if there is none.
+     */
+    int getPackingUnit(const DynInstPtr &inst);
+
+    /** Takes an IQ entry for an instruction, unless it is the tail of a
+     *  macro-op fused at decode, which shares the entry of its head.
+     */
+    void takeEntry(const DynInstPtr &inst);
+
+    /** Gives back the IQ entry taken by an instruction, if any. The head
+     *  of a fused macro-op hands its entry over to its tail instead, if
+     *  the tail is still in the IQ.
+     */
+    void releaseEntry(const DynInstPtr &inst);
+    /// MPINHO 17-oct-2026 END ///
+
     /** Debugging function to count how many entries are in the IQ.  It does
      *  a linear walk through the instructions, so do not call this function
      *  during normal execution.
@@ -563,6 +650,21 @@ class InstructionQueue
     Stats::Formula statFuseSuccessNorm;
     Stats::Formula statFuseSuccessNormTotal;
     /// MPINHO 30-jul-2019 END ///
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Number of fuse successes that required multi-element packing. */
+    Stats::Vector statFuseMultiElement;
+    Stats::Formula statFuseMultiElementNorm;
+    /** Distribution of instructions fused to each fuseable issue. */
+    Stats::Distribution statFusedPerIssue;
+    /** Number of cycles fuseable insts were held back for a partner. */
+    Stats::Scalar statFuseHoldBacks;
+    /** Number of held back insts that fused when issued. */
+    Stats::Scalar statFuseHoldBackFused;
+    /** Number of held back insts that issued without fusing. */
+    Stats::Scalar statFuseHoldBackWasted;
+    /** Number of insts packed into a FU that issued earlier in the cycle. */
+    Stats::Scalar statFuseSteered;
+    /// MPINHO 17-oct-2026 END ///
 
    public:
     Stats::Scalar intInstQueueReads;
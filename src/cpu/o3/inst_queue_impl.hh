@@ -98,23 +98,36 @@ InstructionQueue<Impl>::InstructionQueue(O3CPU *cpu_ptr, IEW *iew_ptr,
       iqPolicy(params->smtIQPolicy),
       numEntries(params->numIQEntries),
       totalWidth(params->issueWidth),
-      commitToIEWDelay(params->commitToIEWDelay)
+      commitToIEWDelay(params->commitToIEWDelay),
+      /// MPINHO 17-oct-2026 BEGIN ///
+      widthHoldBackCycles(params->widthHoldBackCycles)
+      /// MPINHO 17-oct-2026 END ///
 {
     assert(fuPool);
 
     numThreads = params->numThreads;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // With width-aware rename, the register file has a vector register for
+    // each slice.
+    unsigned num_phys_vec_regs = params->numPhysVecRegs *
+        (params->widthAwareRename ? PrecisionBoard::NumSlices : 1);
+
+    for (ThreadID tid = 0; tid < Impl::MaxThreads; tid++)
+        fusePartnersValid[tid] = false;
+    /// MPINHO 17-oct-2026 END ///
+
     // Set the number of total physical registers
     // As the vector registers have two addressing modes, they are added twice
     numPhysRegs = params->numPhysIntRegs + params->numPhysFloatRegs +
-                    params->numPhysVecRegs +
-                    params->numPhysVecRegs * TheISA::NumVecElemPerVecReg +
+                    num_phys_vec_regs +
+                    num_phys_vec_regs * TheISA::NumVecElemPerVecReg +
                     params->numPhysVecPredRegs +
                     params->numPhysCCRegs;
 
     //Create an entry for each physical register within the
     //dependency graph.
-    dependGraph.resize(numPhysRegs);
+    dependGraph.resize(numPhysRegs, numEntries); /// MPINHO 17-oct-2026 ///
 
     // Resize the register scoreboard.
     regScoreboard.resize(numPhysRegs);
@@ -126,9 +139,14 @@ InstructionQueue<Impl>::InstructionQueue(O3CPU *cpu_ptr, IEW *iew_ptr,
     }
 
     // Initialize Width Decoder
-    widthDecoder.init(params);
+    /// MPINHO 17-oct-2026 BEGIN ///
+    widthDecoder.init(params->name, params->widthDefinition,
+                      params->widthBlockSize, params->widthPackingPolicy);
+    widthDecoder.initPredictor(params->widthPredictorSize,
+                               params->widthPredictorCtrBits,
+                               params->widthPredictorThreshold);
+    /// MPINHO 17-oct-2026 END ///
     widthDecoder.setCPU(cpu);
-    widthDecoder.setIQ(this);
 
     resetState();
 
@@ -434,6 +452,48 @@ InstructionQueue<Impl>::regStats()
         ;
     statFuseSuccessNormTotal = statFuseSuccess / iqInstsIssued;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    statFuseMultiElement
+        .init(static_cast<int>(WidthClass::Num_WidthClass))
+        .name(name() + ".fuseMultiElement")
+        .desc("Number of fuse successes that required multi-element"
+              " packing")
+        .flags(total)
+        ;
+    statFuseMultiElementNorm
+        .name(name() + ".fuseMultiElementNorm")
+        .desc("Fraction of fuse successes that required multi-element"
+              " packing")
+        ;
+    statFuseMultiElementNorm = statFuseMultiElement / statFuseSuccess;
+
+    statFusedPerIssue
+        .init(0, fuPool->getMaxIssueCap() - 1, 1)
+        .name(name() + ".fusedPerIssue")
+        .desc("Number of instructions fused to each fuseable inst issued")
+        .flags(pdf)
+        ;
+
+    statFuseHoldBacks
+        .name(name() + ".fuseHoldBacks")
+        .desc("Number of cycles fuseable insts were held back waiting for"
+              " a predicted fuse partner")
+        ;
+    statFuseHoldBackFused
+        .name(name() + ".fuseHoldBackFused")
+        .desc("Number of held back insts that fused when issued")
+        ;
+    statFuseHoldBackWasted
+        .name(name() + ".fuseHoldBackWasted")
+        .desc("Number of held back insts that issued without fusing")
+        ;
+    statFuseSteered
+        .name(name() + ".fuseSteered")
+        .desc("Number of insts packed into a FU that issued earlier in the"
+              " cycle, instead of taking a free FU")
+        ;
+    /// MPINHO 17-oct-2026 END ///
+
     for (int i=0; i < static_cast<int>(WidthClass::Num_WidthClass); i++) {
         statFuseChances.subname(i, WidthClassStrings[i]);
         statFuseChancesNorm.subname(i, WidthClassStrings[i]);
@@ -447,6 +507,8 @@ InstructionQueue<Impl>::regStats()
         statFuseSuccess.subname(i, WidthClassStrings[i]);
         statFuseSuccessNorm.subname(i, WidthClassStrings[i]);
         statFuseSuccessNormTotal.subname(i, WidthClassStrings[i]);
+        statFuseMultiElement.subname(i, WidthClassStrings[i]);
+        statFuseMultiElementNorm.subname(i, WidthClassStrings[i]);
     }
     /// MPINHO 30-jul-2019 END ///
 
@@ -551,11 +613,9 @@ InstructionQueue<Impl>::resetState()
     for (int i = 0; i < Num_OpClasses; ++i) {
         while (!readyInsts[i].empty())
             readyInsts[i].pop();
-        queueOnList[i] = false;
-        readyIt[i] = listOrder.end();
     }
+    readyClasses = 0; /// MPINHO 17-oct-2026 ///
     nonSpecInsts.clear();
-    listOrder.clear();
     deferredMemInsts.clear();
     blockedMemInsts.clear();
     retryMemInsts.clear();
@@ -598,6 +658,18 @@ InstructionQueue<Impl>::isDrained() const
     return drained;
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+bool
+InstructionQueue<Impl>::isQuiescent() const
+{
+    // Mem insts waiting for a retry or for their translation are tried
+    // again on every tick, while cache blocked ones wait for the retry.
+    return !readyClasses && instsToExecute.empty() &&
+           retryMemInsts.empty() && deferredMemInsts.empty();
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 void
 InstructionQueue<Impl>::drainSanityCheck() const
@@ -692,17 +764,16 @@ template <class Impl>
 bool
 InstructionQueue<Impl>::hasReadyInsts()
 {
-    if (!listOrder.empty()) {
-        return true;
-    }
-
+/// MPINHO 17-oct-2026 BEGIN ///
+#ifdef DEBUG
     for (int i = 0; i < Num_OpClasses; ++i) {
-        if (!readyInsts[i].empty()) {
-            return true;
-        }
+        assert(readyInsts[i].empty() ==
+               !(readyClasses & opClassBit(OpClass(i))));
     }
+#endif
 
-    return false;
+    return readyClasses != 0;
+/// MPINHO 17-oct-2026 END ///
 }
 
 template <class Impl>
@@ -722,11 +793,11 @@ InstructionQueue<Impl>::insert(const DynInstPtr &new_inst)
     DPRINTF(IQ, "Adding instruction [sn:%lli] PC %s to the IQ.\n",
             new_inst->seqNum, new_inst->pcState());
 
-    assert(freeEntries != 0);
+    assert(freeEntries != 0 || new_inst->fusedTail); /// MPINHO 17-oct-2026 ///
 
     instList[new_inst->threadNumber].push_back(new_inst);
 
-    --freeEntries;
+    takeEntry(new_inst); /// MPINHO 17-oct-2026 ///
 
     new_inst->setInIQ();
 
@@ -741,13 +812,16 @@ InstructionQueue<Impl>::insert(const DynInstPtr &new_inst)
     if (new_inst->isMemRef()) {
         memDepUnit[new_inst->threadNumber].insert(new_inst);
     } else {
+        /// MPINHO 17-oct-2026 BEGIN ///
+        // Tag with a predicted width before the operands are ready, so
+        // ready insts can wait for it to fuse.
+        widthDecoder.predictWidth(new_inst);
+        /// MPINHO 17-oct-2026 END ///
         addIfReady(new_inst);
     }
 
     ++iqInstsAdded;
 
-    count[new_inst->threadNumber]++;
-
     assert(freeEntries == (numEntries - countInsts()));
 }
 
@@ -773,11 +847,11 @@ InstructionQueue<Impl>::insertNonSpec(const DynInstPtr &new_inst)
             "to the IQ.\n",
             new_inst->seqNum, new_inst->pcState());
 
-    assert(freeEntries != 0);
+    assert(freeEntries != 0 || new_inst->fusedTail); /// MPINHO 17-oct-2026 ///
 
     instList[new_inst->threadNumber].push_back(new_inst);
 
-    --freeEntries;
+    takeEntry(new_inst); /// MPINHO 17-oct-2026 ///
 
     new_inst->setInIQ();
 
@@ -793,8 +867,6 @@ InstructionQueue<Impl>::insertNonSpec(const DynInstPtr &new_inst)
 
     ++iqNonSpecInstsAdded;
 
-    count[new_inst->threadNumber]++;
-
     assert(freeEntries == (numEntries - countInsts()));
 }
 
@@ -824,58 +896,40 @@ InstructionQueue<Impl>::getInstToExecute()
     return inst;
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
 template <class Impl>
 void
-InstructionQueue<Impl>::addToOrderList(OpClass op_class)
+InstructionQueue<Impl>::updateReadyClass(OpClass op_class)
 {
-    assert(!readyInsts[op_class].empty());
-
-    ListOrderEntry queue_entry;
-
-    queue_entry.queueType = op_class;
-
-    queue_entry.oldestInst = readyInsts[op_class].top()->seqNum;
-
-    ListOrderIt list_it = listOrder.begin();
-    ListOrderIt list_end_it = listOrder.end();
-
-    while (list_it != list_end_it) {
-        if ((*list_it).oldestInst > queue_entry.oldestInst) {
-            break;
-        }
-
-        list_it++;
+    if (readyInsts[op_class].empty()) {
+        readyClasses &= ~opClassBit(op_class);
+    } else {
+        readyClasses |= opClassBit(op_class);
+        readyHead[op_class] = readyInsts[op_class].top()->seqNum;
     }
-
-    readyIt[op_class] = listOrder.insert(list_it, queue_entry);
-    queueOnList[op_class] = true;
 }
 
 template <class Impl>
-void
-InstructionQueue<Impl>::moveToYoungerInst(ListOrderIt list_order_it)
+int
+InstructionQueue<Impl>::oldestReadyClass(OpClassMask skip) const
 {
-    // Get iterator of next item on the list
-    // Delete the original iterator
-    // Determine if the next item is either the end of the list or younger
-    // than the new instruction.  If so, then add in a new iterator right here.
-    // If not, then move along.
-    ListOrderEntry queue_entry;
-    OpClass op_class = (*list_order_it).queueType;
-    ListOrderIt next_it = list_order_it;
-
-    ++next_it;
-
-    queue_entry.queueType = op_class;
-    queue_entry.oldestInst = readyInsts[op_class].top()->seqNum;
-
-    while (next_it != listOrder.end() &&
-           (*next_it).oldestInst < queue_entry.oldestInst) {
-        ++next_it;
+    int oldest_class = -1;
+    OpClassMask classes = readyClasses & ~skip;
+
+    // Only the op classes with ready insts are visited, lowest bit first.
+    while (classes) {
+        int op_class = findLsbSet(classes);
+        classes &= classes - 1;
+
+        if (oldest_class < 0 ||
+            readyHead[op_class] < readyHead[oldest_class]) {
+            oldest_class = op_class;
+        }
     }
 
-    readyIt[op_class] = listOrder.insert(next_it, queue_entry);
+    return oldest_class;
 }
+/// MPINHO 17-oct-2026 END ///
 
 template <class Impl>
 void
@@ -886,7 +940,10 @@ InstructionQueue<Impl>::processFUCompletion(const DynInstPtr &inst, int fu_idx)
     // The CPU could have been sleeping until this op completed (*extremely*
     // long latency op).  Wake it if it was.  This may be overkill.
    --wbOutstanding;
-    iewStage->wakeCPU();
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // FU completions run after the CPU tick of the same clock edge.
+    cpu->wakeCPU(Event::Stat_Event_Pri);
+    /// MPINHO 17-oct-2026 END ///
 
     if (fu_idx > -1)
         fuPool->freeUnitNextCycle(fu_idx);
@@ -924,6 +981,12 @@ InstructionQueue<Impl>::scheduleReadyInsts()
     fuPool->resetFUCaps();
     /// MPINHO 23-aug-2019 END ///
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    for (ThreadID tid = 0; tid < numThreads; tid++)
+        fusePartnersValid[tid] = false;
+    packingUnits.clear();
+    /// MPINHO 17-oct-2026 END ///
+
     // Have iterator to head of the list
     // While I haven't exceeded bandwidth or reached the end of the list,
     // Try to get a FU that can do what this op needs.
@@ -933,11 +996,15 @@ InstructionQueue<Impl>::scheduleReadyInsts()
     // This will avoid trying to schedule a certain op class if there are no
     // FUs that handle it.
     int total_issued = 0;
-    ListOrderIt order_it = listOrder.begin();
-    ListOrderIt order_end_it = listOrder.end();
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // Op classes that can not issue more insts in this cycle.
+    OpClassMask skipped_classes = 0;
+    int ready_class;
 
-    while (total_issued < totalWidth && order_it != order_end_it) {
-        OpClass op_class = (*order_it).queueType;
+    while (total_issued < totalWidth &&
+           (ready_class = oldestReadyClass(skipped_classes)) >= 0) {
+        OpClass op_class = static_cast<OpClass>(ready_class);
+    /// MPINHO 17-oct-2026 END ///
 
         assert(!readyInsts[op_class].empty());
 
@@ -951,31 +1018,40 @@ InstructionQueue<Impl>::scheduleReadyInsts()
             intInstQueueReads++;
         }
 
-        assert(issuing_inst->seqNum == (*order_it).oldestInst);
+        assert(issuing_inst->seqNum == readyHead[op_class]);
 
         if (issuing_inst->isSquashed()) {
             readyInsts[op_class].pop();
 
-            if (!readyInsts[op_class].empty()) {
-                moveToYoungerInst(order_it);
-            } else {
-                readyIt[op_class] = listOrder.end();
-                queueOnList[op_class] = false;
-            }
-
-            listOrder.erase(order_it++);
+            updateReadyClass(op_class); /// MPINHO 17-oct-2026 ///
 
             ++iqSquashedInstsIssued;
 
             continue;
         }
 
+        /// MPINHO 17-oct-2026 BEGIN ///
+        if (holdBackForFuse(issuing_inst)) {
+            issuing_inst->incWidthHoldCycles();
+            ++statFuseHoldBacks;
+            skipped_classes |= opClassBit(op_class);
+            continue;
+        }
+        /// MPINHO 17-oct-2026 END ///
+
         int idx = FUPool::NoCapableFU;
         Cycles op_latency = Cycles(1);
         ThreadID tid = issuing_inst->threadNumber;
+        bool packed = false; /// MPINHO 17-oct-2026 ///
 
         if (op_class != No_OpClass) {
-            idx = fuPool->getUnit(op_class);
+            /// MPINHO 17-oct-2026 BEGIN ///
+            // Pack into a FU already issuing before taking a free one.
+            idx = getPackingUnit(issuing_inst);
+            packed = idx >= 0;
+            if (!packed)
+                idx = fuPool->getUnit(op_class);
+            /// MPINHO 17-oct-2026 END ///
             if (issuing_inst->isFloating()) {
                 fpAluAccesses++;
             } else if (issuing_inst->isVector()) {
@@ -997,7 +1073,7 @@ InstructionQueue<Impl>::scheduleReadyInsts()
 
                 // Add the FU onto the list of FU's to be freed next
                 // cycle if we used one.
-                if (idx >= 0)
+                if (idx >= 0 && !packed) /// MPINHO 17-oct-2026 ///
                     fuPool->freeUnitNextCycle(idx);
             } else {
                 bool pipelined = fuPool->isPipelined(op_class);
@@ -1013,6 +1089,10 @@ InstructionQueue<Impl>::scheduleReadyInsts()
                     // If FU isn't pipelined, then it must be freed
                     // upon the execution completing.
                     execution->setFreeFU();
+                /// MPINHO 17-oct-2026 BEGIN ///
+                } else if (packed) {
+                    // The inst that took the FU already frees it.
+                /// MPINHO 17-oct-2026 END ///
                 } else {
                     // Add the FU onto the list of FU's to be freed next
                     // cycle.
@@ -1037,6 +1117,24 @@ InstructionQueue<Impl>::scheduleReadyInsts()
 
                 fuPool->useFUIssueCap(idx);
                 fuPool->useFUWidthCap(idx, issuing_inst->getWidthVal());
+                /// MPINHO 17-oct-2026 BEGIN ///
+                // The first instruction always fits in the FU, and becomes
+                // the base for the packing of the fused ones.
+                if (idx >= 0 && widthDecoder.isFuseType(issuing_inst)) {
+                    widthDecoder.packInst(fuPool->getFUPacking(idx),
+                                          issuing_inst);
+                    if (packed) {
+                        ++statFuseSteered;
+                        DPRINTF(IQFuse, "Packed inst \"%s\" into FU %d,"
+                                " which issued earlier in this cycle.\n",
+                                issuing_inst->staticInst->disassemble(
+                                    issuing_inst->instAddr()),
+                                idx);
+                    } else if (fuPool->consolidates()) {
+                        packingUnits.emplace_back(idx, issuing_inst);
+                    }
+                }
+                /// MPINHO 17-oct-2026 END ///
             }
             /// MPINHO 23-aug-2019 END ///
 
@@ -1047,12 +1145,7 @@ InstructionQueue<Impl>::scheduleReadyInsts()
 
             readyInsts[op_class].pop();
 
-            if (!readyInsts[op_class].empty()) {
-                moveToYoungerInst(order_it);
-            } else {
-                readyIt[op_class] = listOrder.end();
-                queueOnList[op_class] = false;
-            }
+            updateReadyClass(op_class); /// MPINHO 17-oct-2026 ///
 
             issuing_inst->setIssued();
             ++total_issued;
@@ -1064,14 +1157,12 @@ InstructionQueue<Impl>::scheduleReadyInsts()
             if (!issuing_inst->isMemRef()) {
                 // Memory instructions can not be freed from the IQ until
                 // they complete.
-                ++freeEntries;
-                count[tid]--;
+                releaseEntry(issuing_inst); /// MPINHO 17-oct-2026 ///
                 issuing_inst->clearInIQ();
             } else {
                 memDepUnit[tid].issue(issuing_inst);
             }
 
-            order_it = listOrder.erase(order_it);
             statIssuedInstType[tid][op_class]++;
             /// MPINHO 30-jul-2019 BEGIN ///
             WidthClass width_class = issuing_inst->getWidthClass();
@@ -1085,7 +1176,7 @@ InstructionQueue<Impl>::scheduleReadyInsts()
             // If a fuseable instruction has been successufully issued, loops
             // through the next ready instructions in search of compatible fuse
             // candidates.
-            if (widthDecoder.isFuseType(issuing_inst)) {
+            if (idx >= 0 && widthDecoder.isFuseType(issuing_inst)) {
                 // First fuseable inst found: trace, stat.
                 DPRINTF(IQFuse,
                         "Found instruction \"%s\" suitable for fuse,"
@@ -1098,14 +1189,23 @@ InstructionQueue<Impl>::scheduleReadyInsts()
                         fuPool->getFUIssueCap(idx),
                         idx);
 
-                // Try to issue extra instructions, of a compatible fuse type.
-                ListOrderIt fuse_order_it = order_it;
+                // Try to issue extra instructions, of a compatible fuse type,
+                // until the FU runs out of issue or width capacity.
+                int fused_insts = 0;
+                /// MPINHO 17-oct-2026 BEGIN ///
+                // Candidates are the oldest ready inst of each op class not
+                // skipped, in age order. Op classes whose candidate can not
+                // fuse are skipped for the rest of the search.
+                OpClassMask fuse_skipped_classes = skipped_classes;
+                int fuse_class;
                 while (total_issued < totalWidth &&
-                      fuse_order_it != order_end_it &&
                       fuPool->getFUIssueCap(idx) > 0 &&
-                      fuPool->getFUWidthCap(idx) > 0) {
+                      fuPool->getFUWidthCap(idx) > 0 &&
+                      (fuse_class =
+                          oldestReadyClass(fuse_skipped_classes)) >= 0) {
 
-                    OpClass fuse_op_class = (*fuse_order_it).queueType;
+                    OpClass fuse_op_class = static_cast<OpClass>(fuse_class);
+                /// MPINHO 17-oct-2026 END ///
 
                     assert(!readyInsts[fuse_op_class].empty());
                     DynInstPtr fuse_candidate_inst =
@@ -1117,7 +1217,8 @@ InstructionQueue<Impl>::scheduleReadyInsts()
                                 "\tIgnored squashed instruction \"%s\".\n",
                                 fuse_candidate_inst->staticInst->
                                     disassemble(issuing_inst->instAddr()));
-                        ++fuse_order_it;
+                        fuse_skipped_classes |=
+                            opClassBit(fuse_op_class);
                         continue;
                     }
                     if (!fuPool->hasCapability(idx, fuse_op_class)) {
@@ -1128,7 +1229,8 @@ InstructionQueue<Impl>::scheduleReadyInsts()
                                     disassemble(issuing_inst->instAddr()),
                                 Enums::OpClassStrings[
                                     static_cast<int>(fuse_op_class)]);
-                        ++fuse_order_it;
+                        fuse_skipped_classes |=
+                            opClassBit(fuse_op_class);
                         continue;
                     }
                     if (!fuPool->isPipelined(fuse_op_class)) {
@@ -1138,7 +1240,8 @@ InstructionQueue<Impl>::scheduleReadyInsts()
                                 fuse_candidate_inst->staticInst->
                                     disassemble(
                                         issuing_inst->instAddr()));
-                        ++fuse_order_it;
+                        fuse_skipped_classes |=
+                            opClassBit(fuse_op_class);
                         continue;
                     }
                     if (fuse_candidate_inst->isMemRef()) {
@@ -1147,7 +1250,8 @@ InstructionQueue<Impl>::scheduleReadyInsts()
                                 fuse_candidate_inst->staticInst->
                                     disassemble(
                                         issuing_inst->instAddr()));
-                        ++fuse_order_it;
+                        fuse_skipped_classes |=
+                            opClassBit(fuse_op_class);
                         continue;
                     }
 
@@ -1160,11 +1264,22 @@ InstructionQueue<Impl>::scheduleReadyInsts()
                         statFuseChances[
                             static_cast<int>(fuse_width_class)]++;
 
+                        PackingSlot &fu_packing = fuPool->getFUPacking(idx);
+
                         if (fuse_candidate_inst->getWidthVal() <=
-                            fuPool->getFUWidthCap(idx)) {
+                            fuPool->getFUWidthCap(idx) &&
+                            widthDecoder.canPackInst(fu_packing,
+                                                     fuse_candidate_inst)) {
                             // Fuse success.
                             statFuseSuccess[
                                 static_cast<int>(fuse_width_class)]++;
+                            if (widthDecoder.isMultiElementFuse(
+                                    fu_packing, fuse_candidate_inst)) {
+                                statFuseMultiElement[
+                                    static_cast<int>(fuse_width_class)]++;
+                            }
+                            widthDecoder.packInst(fu_packing,
+                                                  fuse_candidate_inst);
                             DPRINTF(IQFuse,
                                     "\tWill issued fused inst \"%s\","
                                     " with WidthClass: %S,\n",
@@ -1222,17 +1337,8 @@ InstructionQueue<Impl>::scheduleReadyInsts()
 
                             readyInsts[fuse_op_class].pop();
 
-                            if (!readyInsts[fuse_op_class].empty()) {
-                                // The new ready inst for this OpClass is
-                                // certainly older than this one, so it is
-                                // inserted after it in the listOrder.
-                                moveToYoungerInst(fuse_order_it);
-                            } else {
-                                // Mark that there are no ready insts for
-                                // this OpClass.
-                                readyIt[fuse_op_class] = listOrder.end();
-                                queueOnList[fuse_op_class] = false;
-                            }
+                            /// MPINHO 17-oct-2026 ///
+                            updateReadyClass(fuse_op_class);
 
                             // Mark instruction as issued.
                             fuse_candidate_inst->setIssued();
@@ -1244,20 +1350,10 @@ InstructionQueue<Impl>::scheduleReadyInsts()
 #endif
 
                             // Free from IQ.
-                            ++freeEntries;
-                            count[tid]--;
+                            /// MPINHO 17-oct-2026 ///
+                            releaseEntry(fuse_candidate_inst);
                             fuse_candidate_inst->clearInIQ();
 
-                            // Remove from ordered ready list.
-                            if (order_it == fuse_order_it) {
-                                // Must also advance the order_it iterator.
-                                order_it = fuse_order_it =
-                                    listOrder.erase(fuse_order_it);
-                            } else {
-                                fuse_order_it =
-                                    listOrder.erase(fuse_order_it);
-                            }
-
                             statIssuedInstType[tid][fuse_op_class]++;
                             statIssuedWidthClass[
                                 static_cast<int>(fuse_width_class)]++;
@@ -1265,9 +1361,10 @@ InstructionQueue<Impl>::scheduleReadyInsts()
                                 statIssuedVecElemSize[
                                     static_cast<int>(fuse_width_class)]++;
 
-                            // FIXME: Only one fuse inst can be issued per
-                            // opportunity.
-                            break;
+                            ++fused_insts;
+
+                            // Keep looking for more fuse partners.
+                            continue;
                         } else {
                             // Fuse opportunity lost due to width mismatch.
                             statFuseFailNoMatch[
@@ -1287,14 +1384,25 @@ InstructionQueue<Impl>::scheduleReadyInsts()
                                     disassemble(issuing_inst->instAddr()));
                     }
 
-                    ++fuse_order_it;
+                    fuse_skipped_classes |= opClassBit(fuse_op_class);
                 }
+
+                /// MPINHO 17-oct-2026 BEGIN ///
+                if (!packed)
+                    statFusedPerIssue.sample(fused_insts);
+                if (issuing_inst->getWidthHoldCycles() > 0) {
+                    if (fused_insts > 0 || packed)
+                        ++statFuseHoldBackFused;
+                    else
+                        ++statFuseHoldBackWasted;
+                }
+                /// MPINHO 17-oct-2026 END ///
             }
             /// MPINHO 12-aug-2019 END ///
         } else {
             statFuBusy[op_class]++;
             fuBusy[tid]++;
-            ++order_it;
+            skipped_classes |= opClassBit(op_class); /// MPINHO 17-oct-2026 ///
         }
     }
 
@@ -1317,6 +1425,129 @@ InstructionQueue<Impl>::scheduleReadyInsts()
     }
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+bool
+InstructionQueue<Impl>::holdBackForFuse(const DynInstPtr &inst)
+{
+    if (widthHoldBackCycles == 0 ||
+        inst->getWidthHoldCycles() >= widthHoldBackCycles ||
+        inst->isMemRef() ||
+        !widthDecoder.isFuseType(inst)) {
+        return false;
+    }
+
+    // Ready insts of the same class can already fuse in this cycle.
+    OpClass op_class = inst->opClass();
+    if (readyInsts[op_class].size() > 1)
+        return false;
+
+    ThreadID tid = inst->threadNumber;
+    std::vector<DynInstPtr> &partners = fusePartners[tid];
+
+    if (!fusePartnersValid[tid]) {
+        partners.clear();
+        for (const auto &pred_inst : instList[tid]) {
+            if (pred_inst->hasPredWidth() &&
+                !pred_inst->readyToIssue() &&
+                !pred_inst->isIssued() &&
+                !pred_inst->isSquashed()) {
+                partners.push_back(pred_inst);
+            }
+        }
+        fusePartnersValid[tid] = true;
+    }
+
+    for (const auto &pred_inst : partners) {
+        if (pred_inst->opClass() != op_class ||
+            pred_inst->isSquashed() ||
+            !widthDecoder.canFusePredicted(inst, pred_inst)) {
+            continue;
+        }
+
+        // A partner waiting on inst can never issue with it.
+        if (pred_inst->seqNum > inst->seqNum && waitsOn(pred_inst, inst))
+            continue;
+
+        DPRINTF(IQFuse, "Holding back inst \"%s\" [sn:%lli] for"
+                " predicted fuse partner \"%s\" [sn:%lli].\n",
+                inst->staticInst->disassemble(inst->instAddr()),
+                inst->seqNum,
+                pred_inst->staticInst->disassemble(pred_inst->instAddr()),
+                pred_inst->seqNum);
+        return true;
+    }
+
+    return false;
+}
+
+template <class Impl>
+int
+InstructionQueue<Impl>::getPackingUnit(const DynInstPtr &inst)
+{
+    OpClass op_class = inst->opClass();
+
+    if (packingUnits.empty() ||
+        inst->isMemRef() ||
+        !widthDecoder.isFuseType(inst) ||
+        !fuPool->isPipelined(op_class)) {
+        return -1;
+    }
+
+    for (const auto &unit : packingUnits) {
+        int fu_idx = unit.first;
+
+        if (fuPool->hasCapability(fu_idx, op_class) &&
+            fuPool->getFUIssueCap(fu_idx) > 0 &&
+            inst->getWidthVal() <= fuPool->getFUWidthCap(fu_idx) &&
+            widthDecoder.matchFuseType(unit.second, inst) &&
+            widthDecoder.canPackInst(fuPool->getFUPacking(fu_idx), inst)) {
+            return fu_idx;
+        }
+    }
+
+    return -1;
+}
+
+template <class Impl>
+bool
+InstructionQueue<Impl>::waitsOn(const DynInstPtr &consumer,
+                                const DynInstPtr &producer, int depth)
+{
+    for (int src_reg_idx = 0;
+         src_reg_idx < consumer->numSrcRegs();
+         src_reg_idx++)
+    {
+        if (consumer->isReadySrcRegIdx(src_reg_idx))
+            continue;
+
+        PhysRegIdPtr src_reg = consumer->renamedSrcRegIdx(src_reg_idx);
+        if (src_reg->isFixedMapping())
+            continue;
+
+        const DynInstPtr &src_inst = dependGraph.producer(
+            src_reg->flatIndex());
+
+        // Issued and older insts do not wait on producer.
+        if (!src_inst || src_inst->isIssued() ||
+            src_inst->seqNum < producer->seqNum) {
+            continue;
+        }
+
+        if (src_inst == producer)
+            return true;
+
+        // Long chains are assumed to reach producer.
+        if (depth >= MaxWaitDepth ||
+            waitsOn(src_inst, producer, depth + 1)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 void
 InstructionQueue<Impl>::scheduleNonSpec(const InstSeqNum &inst)
@@ -1363,12 +1594,26 @@ InstructionQueue<Impl>::commit(const InstSeqNum &inst, ThreadID tid)
     assert(freeEntries == (numEntries - countInsts()));
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+void
+InstructionQueue<Impl>::setPrecisionBoard(PrecisionBoard *pb_ptr)
+{
+    widthDecoder.setPrecisionBoard(pb_ptr);
+}
+
+template <class Impl>
+void
+InstructionQueue<Impl>::writebackWidth(const DynInstPtr &completed_inst)
+{
+    widthDecoder.writebackWidth(completed_inst);
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 int
 InstructionQueue<Impl>::wakeDependents(const DynInstPtr &completed_inst)
 {
-    int dependents = 0;
-
     // The instruction queue here takes care of both floating and int ops
     if (completed_inst->isFloating()) {
         fpInstQueueWakeupAccesses++;
@@ -1396,6 +1641,17 @@ InstructionQueue<Impl>::wakeDependents(const DynInstPtr &completed_inst)
         memDepUnit[completed_inst->threadNumber].completeBarrier(completed_inst);
     }
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    return wakeRegDependents(completed_inst);
+}
+
+template <class Impl>
+int
+InstructionQueue<Impl>::wakeRegDependents(const DynInstPtr &completed_inst)
+{
+    int dependents = 0;
+    /// MPINHO 17-oct-2026 END ///
+
     for (int dest_reg_idx = 0;
          dest_reg_idx < completed_inst->numDestRegs();
          dest_reg_idx++)
@@ -1455,15 +1711,7 @@ InstructionQueue<Impl>::addReadyMemInst(const DynInstPtr &ready_inst)
 
     readyInsts[op_class].push(ready_inst);
 
-    // Will need to reorder the list if either a queue is not on the list,
-    // or it has an older instruction than last time.
-    if (!queueOnList[op_class]) {
-        addToOrderList(op_class);
-    } else if (readyInsts[op_class].top()->seqNum  <
-               (*readyIt[op_class]).oldestInst) {
-        listOrder.erase(readyIt[op_class]);
-        addToOrderList(op_class);
-    }
+    updateReadyClass(op_class); /// MPINHO 17-oct-2026 ///
 
     DPRINTF(IQ, "Instruction is ready to issue, putting it onto "
             "the ready list, PC %s opclass:%i [sn:%lli].\n",
@@ -1500,12 +1748,11 @@ InstructionQueue<Impl>::completeMemInst(const DynInstPtr &completed_inst)
     DPRINTF(IQ, "Completing mem instruction PC: %s [sn:%lli]\n",
             completed_inst->pcState(), completed_inst->seqNum);
 
-    ++freeEntries;
+    releaseEntry(completed_inst); /// MPINHO 17-oct-2026 ///
 
     completed_inst->memOpDone(true);
 
     memDepUnit[tid].completed(completed_inst);
-    count[tid]--;
 }
 
 template <class Impl>
@@ -1702,9 +1949,7 @@ InstructionQueue<Impl>::doSquash(ThreadID tid)
             squashed_inst->clearInIQ();
 
             //Update Thread IQ Count
-            count[squashed_inst->threadNumber]--;
-
-            ++freeEntries;
+            releaseEntry(squashed_inst); /// MPINHO 17-oct-2026 ///
         }
 
         // IQ clears out the heads of the dependency graph only when
@@ -1855,17 +2100,45 @@ InstructionQueue<Impl>::addIfReady(const DynInstPtr &inst)
 
         readyInsts[op_class].push(inst);
 
-        // Will need to reorder the list if either a queue is not on the list,
-        // or it has an older instruction than last time.
-        if (!queueOnList[op_class]) {
-            addToOrderList(op_class);
-        } else if (readyInsts[op_class].top()->seqNum  <
-                   (*readyIt[op_class]).oldestInst) {
-            listOrder.erase(readyIt[op_class]);
-            addToOrderList(op_class);
+        updateReadyClass(op_class); /// MPINHO 17-oct-2026 ///
+    }
+}
+
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+void
+InstructionQueue<Impl>::takeEntry(const DynInstPtr &inst)
+{
+    if (inst->fusedTail)
+        return;
+
+    --freeEntries;
+    count[inst->threadNumber]++;
+}
+
+template <class Impl>
+void
+InstructionQueue<Impl>::releaseEntry(const DynInstPtr &inst)
+{
+    if (inst->fusedTail && !inst->holdsFusedEntry)
+        return;
+
+    // The tail of a fused pair depends on its head, so it usually leaves
+    // the IQ later, and keeps the entry of the pair until then.
+    if (inst->fusedTailInst) {
+        DynInstPtr tail = std::move(inst->fusedTailInst);
+        if (tail->isInIQ()) {
+            DPRINTF(IQ, "Handing the entry of [sn:%lli] over to its fused "
+                    "tail [sn:%lli].\n", inst->seqNum, tail->seqNum);
+            tail->holdsFusedEntry = true;
+            return;
         }
     }
+
+    ++freeEntries;
+    count[inst->threadNumber]--;
 }
+/// MPINHO 17-oct-2026 END ///
 
 template <class Impl>
 int
@@ -1928,19 +2201,21 @@ InstructionQueue<Impl>::dumpLists()
 
     cprintf("\n");
 
-    ListOrderIt list_order_it = listOrder.begin();
-    ListOrderIt list_order_end_it = listOrder.end();
+    /// MPINHO 17-oct-2026 BEGIN ///
+    OpClassMask listed_classes = 0;
+    int op_class;
     int i = 1;
 
     cprintf("List order: ");
 
-    while (list_order_it != list_order_end_it) {
-        cprintf("%i OpClass:%i [sn:%lli] ", i, (*list_order_it).queueType,
-                (*list_order_it).oldestInst);
+    while ((op_class = oldestReadyClass(listed_classes)) >= 0) {
+        cprintf("%i OpClass:%i [sn:%lli] ", i, op_class,
+                readyHead[op_class]);
 
-        ++list_order_it;
+        listed_classes |= opClassBit(static_cast<OpClass>(op_class));
         ++i;
     }
+    /// MPINHO 17-oct-2026 END ///
 
     cprintf("\n");
 }
@@ -0,0 +1,94 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+
+#include "cpu/o3/load_value_predictor.hh"
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+LoadValuePredictor::LoadValuePredictor()
+    : policy(LoadValuePredPolicy::Disabled),
+      indexMask(0),
+      threshold(0)
+{}
+
+void
+LoadValuePredictor::init(LoadValuePredPolicy _policy, unsigned size,
+                         unsigned counter_bits, unsigned _threshold)
+{
+    policy = _policy;
+
+    if (!enabled())
+        return;
+
+    if (!isPowerOf2(size)) {
+        fatal("Invalid load value predictor size (%u), must be a power "
+              "of 2.\n", size);
+    }
+    if (_threshold >= (1u << counter_bits)) {
+        fatal("Load value predictor threshold (%u) is not reachable with"
+              " %u-bit counters.\n", _threshold, counter_bits);
+    }
+
+    table.assign(size, Entry());
+    for (auto &entry : table) {
+        entry.confidence.setBits(counter_bits);
+    }
+
+    indexMask = size - 1;
+    threshold = _threshold;
+}
+
+uint64_t
+LoadValuePredictor::predicted(const Entry &entry) const
+{
+    if (policy == LoadValuePredPolicy::Stride)
+        return entry.value + entry.stride;
+
+    return entry.value;
+}
+
+bool
+LoadValuePredictor::lookup(Addr pc, uint64_t &value) const
+{
+    if (!enabled())
+        return false;
+
+    const Entry &entry = table[index(pc)];
+
+    if (!entry.valid || entry.tag != pc ||
+        entry.confidence.read() < threshold) {
+        return false;
+    }
+
+    value = predicted(entry);
+    return true;
+}
+
+void
+LoadValuePredictor::update(Addr pc, uint64_t value)
+{
+    if (!enabled())
+        return;
+
+    Entry &entry = table[index(pc)];
+
+    if (!entry.valid || entry.tag != pc) {
+        entry.valid = true;
+        entry.tag = pc;
+        entry.value = value;
+        entry.stride = 0;
+        entry.confidence.reset();
+        return;
+    }
+
+    if (predicted(entry) == value) {
+        entry.confidence.increment();
+    } else {
+        entry.confidence.reset();
+    }
+
+    entry.stride = value - entry.value;
+    entry.value = value;
+}
+
+/// MPINHO 17-oct-2026 END ///
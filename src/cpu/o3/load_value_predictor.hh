@@ -0,0 +1,80 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+#ifndef __CPU_O3_LOAD_VALUE_PREDICTOR_HH__
+#define __CPU_O3_LOAD_VALUE_PREDICTOR_HH__
+
+#include <vector>
+
+#include "base/types.hh"
+#include "cpu/pred/sat_counter.hh"
+#include "enums/LoadValuePredPolicy.hh"
+
+/**
+ * PC indexed predictor of the value returned by a load.
+ *
+ * Each entry keeps the last value loaded by a PC and, for the stride
+ * policy, the difference between the last two values. The last value
+ * policy predicts the last value again, the stride policy predicts the
+ * last value plus the stride. A confidence counter grows while the
+ * predictions would have been right and is reset otherwise, and a value is
+ * only predicted once it reaches the threshold.
+ */
+class LoadValuePredictor
+{
+  private:
+    /** Predictor entry. */
+    struct Entry
+    {
+        /** Whether the entry holds a value. */
+        bool valid;
+        /** PC of the load the entry belongs to. */
+        Addr tag;
+        /** Last value loaded. */
+        uint64_t value;
+        /** Difference between the last two values loaded. */
+        int64_t stride;
+        /** Confidence on the prediction. */
+        SatCounter confidence;
+
+        Entry() : valid(false), tag(0), value(0), stride(0) {}
+    };
+
+    /** Prediction policy. */
+    LoadValuePredPolicy policy;
+
+    /** Predictor table. */
+    std::vector<Entry> table;
+
+    /** Mask to index the table. */
+    Addr indexMask;
+
+    /** Confidence needed to give a prediction. */
+    unsigned threshold;
+
+    /** Returns the entry of a PC. */
+    unsigned index(Addr pc) const { return (pc >> 2) & indexMask; }
+
+    /** Returns the value an entry predicts. */
+    uint64_t predicted(const Entry &entry) const;
+
+  public:
+    LoadValuePredictor();
+
+    /** Sets the policy and the size of the predictor and its counters. */
+    void init(LoadValuePredPolicy policy, unsigned size,
+              unsigned counter_bits, unsigned threshold);
+
+    /** Whether loads are predicted at all. */
+    bool enabled() const { return policy != LoadValuePredPolicy::Disabled; }
+
+    /**
+     * Looks up the value loaded by the load in a PC. Returns true, and the
+     * predicted value, if confident.
+     */
+    bool lookup(Addr pc, uint64_t &value) const;
+
+    /** Trains the predictor with the value actually loaded. */
+    void update(Addr pc, uint64_t value);
+};
+
+#endif // __CPU_O3_LOAD_VALUE_PREDICTOR_HH__
+/// MPINHO 17-oct-2026 END ///
@@ -49,6 +49,7 @@
 
 #include "arch/generic/tlb.hh"
 #include "cpu/inst_seq.hh"
+#include "cpu/o3/load_value_predictor.hh" /// MPINHO 17-oct-2026 ///
 #include "cpu/o3/lsq_unit.hh"
 #include "enums/SMTQueuePolicy.hh"
 #include "mem/port.hh"
@@ -966,6 +967,11 @@ class LSQ
     /** Another store port is in use */
     void cachePortBusy(bool is_load);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Returns the load value predictor shared by all threads. */
+    LoadValuePredictor &valuePredictor() { return valuePred; }
+    /// MPINHO 17-oct-2026 END ///
+
   protected:
     /** D-cache is blocked */
     bool _cacheBlocked;
@@ -978,6 +984,11 @@ class LSQ
     /** The number of used cache ports in this cycle by loads. */
     int usedLoadPorts;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Load value predictor. */
+    LoadValuePredictor valuePred;
+    /// MPINHO 17-oct-2026 END ///
+
 
     /** The LSQ policy for SMT mode. */
     SMTQueuePolicy lsqPolicy;
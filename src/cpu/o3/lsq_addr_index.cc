@@ -0,0 +1,79 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+
+#include "cpu/o3/lsq_addr_index.hh"
+
+#include <algorithm>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+LSQAddrIndex::LSQAddrIndex()
+    : bucketMask(0),
+      bucketBits(0),
+      granuleShift(0),
+      numRanges(0)
+{}
+
+void
+LSQAddrIndex::init(unsigned num_buckets, unsigned granule_shift)
+{
+    if (!isPowerOf2(num_buckets)) {
+        fatal("Invalid LSQ address index size (%u), must be a power of 2.\n",
+              num_buckets);
+    }
+
+    counts.assign(num_buckets, 0);
+    bucketMask = num_buckets - 1;
+    bucketBits = floorLog2(num_buckets);
+    granuleShift = granule_shift;
+    numRanges = 0;
+}
+
+void
+LSQAddrIndex::insert(Addr addr, unsigned size)
+{
+    assert(size > 0);
+
+    Addr last = (addr + size - 1) >> granuleShift;
+    for (Addr granule = addr >> granuleShift; granule <= last; ++granule)
+        ++counts[bucket(granule)];
+
+    ++numRanges;
+}
+
+void
+LSQAddrIndex::remove(Addr addr, unsigned size)
+{
+    assert(size > 0 && numRanges > 0);
+
+    Addr last = (addr + size - 1) >> granuleShift;
+    for (Addr granule = addr >> granuleShift; granule <= last; ++granule) {
+        assert(counts[bucket(granule)] > 0);
+        --counts[bucket(granule)];
+    }
+
+    --numRanges;
+}
+
+bool
+LSQAddrIndex::mayOverlap(Addr addr, unsigned size) const
+{
+    if (numRanges == 0)
+        return false;
+
+    Addr last = (addr + std::max(size, 1u) - 1) >> granuleShift;
+    for (Addr granule = addr >> granuleShift; granule <= last; ++granule) {
+        if (counts[bucket(granule)])
+            return true;
+    }
+
+    return false;
+}
+
+void
+LSQAddrIndex::clear()
+{
+    std::fill(counts.begin(), counts.end(), 0);
+    numRanges = 0;
+}
+/// MPINHO 17-oct-2026 END ///
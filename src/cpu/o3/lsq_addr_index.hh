@@ -0,0 +1,74 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+#ifndef __CPU_O3_LSQ_ADDR_INDEX_HH__
+#define __CPU_O3_LSQ_ADDR_INDEX_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+
+/**
+ * Counting hash index of the address ranges of in-flight memory
+ * instructions.
+ *
+ * Ranges are split in aligned granules, and each granule is hashed to a
+ * bucket that counts the indexed ranges touching it. A zero count proves
+ * that no indexed range touches the granule, so the LSQ only has to search
+ * its queues when a lookup hits non-zero buckets.
+ */
+class LSQAddrIndex
+{
+  private:
+    /** Number of indexed ranges touching each bucket. */
+    std::vector<uint32_t> counts;
+
+    /** Mask to index the buckets. */
+    Addr bucketMask;
+
+    /** Log2 of the bucket count. */
+    unsigned bucketBits;
+
+    /** Log2 of the granule size, in bytes. */
+    unsigned granuleShift;
+
+    /** Number of indexed ranges. */
+    unsigned numRanges;
+
+    /** Returns the bucket of a granule. */
+    unsigned
+    bucket(Addr granule) const
+    {
+        return (granule ^ (granule >> bucketBits)) & bucketMask;
+    }
+
+  public:
+    LSQAddrIndex();
+
+    /**
+     * Sets the number of buckets, which must be a power of 2, and the
+     * granule size. Ranges that touch the same granule always overlap in
+     * the index.
+     */
+    void init(unsigned num_buckets, unsigned granule_shift);
+
+    /** Adds the range of size bytes starting at addr. */
+    void insert(Addr addr, unsigned size);
+
+    /** Removes a range previously added with the same addr and size. */
+    void remove(Addr addr, unsigned size);
+
+    /**
+     * Returns false if no indexed range touches a granule of the range of
+     * size bytes starting at addr, true if some may.
+     */
+    bool mayOverlap(Addr addr, unsigned size) const;
+
+    /** Removes all ranges. */
+    void clear();
+
+    /** Returns the number of indexed ranges. */
+    unsigned size() const { return numRanges; }
+};
+
+#endif // __CPU_O3_LSQ_ADDR_INDEX_HH__
+/// MPINHO 17-oct-2026 END ///
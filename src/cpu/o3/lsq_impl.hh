@@ -99,6 +99,12 @@ LSQ<Impl>::LSQ(O3CPU *cpu_ptr, IEW *iew_ptr, DerivO3CPUParams *params)
                     "Partitioned, Threshold");
     }
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    valuePred.init(params->loadValuePredPolicy, params->loadValuePredSize,
+                   params->loadValuePredCtrBits,
+                   params->loadValuePredThreshold);
+    /// MPINHO 17-oct-2026 END ///
+
     thread.reserve(numThreads);
     for (ThreadID tid = 0; tid < numThreads; tid++) {
         thread.emplace_back(maxLQEntries, maxSQEntries);
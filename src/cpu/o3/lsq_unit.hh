@@ -56,6 +56,7 @@
 #include "arch/mmapped_ipr.hh"
 #include "config/the_isa.hh"
 #include "cpu/inst_seq.hh"
+#include "cpu/o3/lsq_addr_index.hh" /// MPINHO 17-oct-2026 ///
 #include "cpu/timebuf.hh"
 #include "debug/LSQUnit.hh"
 #include "mem/packet.hh"
@@ -100,10 +101,21 @@ class LSQUnit
         uint8_t _size;
         /** Valid entry. */
         bool _valid;
+        /// MPINHO 17-oct-2026 BEGIN ///
+        /** Whether the entry is in the LSQ address index. */
+        bool _indexed;
+        /** Start of the address range in the LSQ address index. */
+        Addr _indexAddr;
+        /** Size of the address range in the LSQ address index. */
+        unsigned _indexSize;
+        /// MPINHO 17-oct-2026 END ///
       public:
         /** Constructs an empty store queue entry. */
         LSQEntry()
-            : inst(nullptr), req(nullptr), _size(0), _valid(false)
+            : inst(nullptr), req(nullptr), _size(0), _valid(false),
+              /// MPINHO 17-oct-2026 BEGIN ///
+              _indexed(false), _indexAddr(0), _indexSize(0)
+              /// MPINHO 17-oct-2026 END ///
         {
         }
 
@@ -126,6 +138,7 @@ class LSQUnit
             req = nullptr;
             _valid = false;
             _size = 0;
+            _indexed = false; /// MPINHO 17-oct-2026 ///
         }
 
         void
@@ -145,6 +158,19 @@ class LSQUnit
         uint8_t& size() { return _size; }
         const uint8_t& size() const { return _size; }
         const DynInstPtr& instruction() const { return inst; }
+        /// MPINHO 17-oct-2026 BEGIN ///
+        bool indexed() const { return _indexed; }
+        Addr indexAddr() const { return _indexAddr; }
+        unsigned indexSize() const { return _indexSize; }
+        void
+        setIndexed(Addr addr, unsigned size)
+        {
+            _indexed = true;
+            _indexAddr = addr;
+            _indexSize = size;
+        }
+        void clearIndexed() { _indexed = false; }
+        /// MPINHO 17-oct-2026 END ///
         /** @} */
     };
 
@@ -483,6 +509,51 @@ class LSQUnit
     /** Should loads be checked for dependency issues */
     bool checkLoads;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Address index of the stores in the SQ with data. */
+    LSQAddrIndex storeIndex;
+
+    /** Address index of the loads in the LQ with a valid address. */
+    LSQAddrIndex loadIndex;
+
+    /** Records the address range of an LSQ entry in an address index,
+     *  replacing the range it had, if any.
+     */
+    void indexEntry(LSQEntry &entry, LSQAddrIndex &index, Addr addr,
+                    unsigned size);
+
+    /** Removes an LSQ entry from the address index it is recorded in. */
+    void unindexEntry(LSQEntry &entry, LSQAddrIndex &index);
+
+    /** Key of a load in the value predictor. The micro-ops of a macro-op
+     *  share its PC, so the micro PC is folded in.
+     */
+    static Addr
+    valuePredKey(const DynInstPtr &inst)
+    {
+        return inst->instAddr() ^ (Addr(inst->microPC()) << 2);
+    }
+
+    /** Whether the value predictor covers a load: it must write a single
+     *  integer register and not be a locked or prefetch access.
+     */
+    bool valuePredictable(const DynInstPtr &inst,
+                          const RequestPtr &req) const;
+
+    /**
+     * Predicts the value of a load sent to memory, if the predictor is
+     * confident, and wakes its dependents with it.
+     */
+    void predictValue(const DynInstPtr &inst, const RequestPtr &req);
+
+    /**
+     * Checks the predicted value of a completed load against the loaded
+     * one, squashing its younger instructions on a mismatch, and trains
+     * the predictor.
+     */
+    void verifyValue(const DynInstPtr &inst, const RequestPtr &req);
+    /// MPINHO 17-oct-2026 END ///
+
     /** The number of load instructions in the LQ. */
     int loads;
     /** The number of store instructions in the SQ. */
@@ -566,6 +637,43 @@ class LSQUnit
     /** Number of times the LSQ is blocked due to the cache. */
     Stats::Scalar lsqCacheBlocked;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Number of SQ entries examined per store to load forwarding search. */
+    Stats::Distribution lsqForwSearchLength;
+
+    /** Number of forwarding searches skipped by the store index. */
+    Stats::Scalar lsqForwSearchSkipped;
+
+    /** Number of LQ entries examined per ordering violation search. */
+    Stats::Distribution lsqViolSearchLength;
+
+    /** Number of violation searches skipped by the load index. */
+    Stats::Scalar lsqViolSearchSkipped;
+
+    /** Number of completed loads covered by the value predictor. */
+    Stats::Scalar lvpEligible;
+
+    /** Number of loads whose value was predicted correctly. */
+    Stats::Scalar lvpCorrect;
+
+    /** Number of loads whose value was mispredicted. */
+    Stats::Scalar lvpIncorrect;
+
+    /** Fraction of the covered loads with a predicted value. */
+    Stats::Formula lvpCoverage;
+
+    /** Fraction of the predicted values that were correct. */
+    Stats::Formula lvpAccuracy;
+
+    /** Number of instructions squashed by value mispredictions. */
+    Stats::Scalar lvpSquashedInsts;
+
+    /** Cycles the dependents of a mispredicted load ran on a wrong value
+     *  before it was detected.
+     */
+    Stats::Distribution lvpRecoveryCycles;
+    /// MPINHO 17-oct-2026 END ///
+
   public:
     /** Executes the load at the given index. */
     Fault read(LSQRequest *req, int load_idx);
@@ -674,10 +782,20 @@ LSQUnit<Impl>::read(LSQRequest *req, int load_idx)
     // Check the SQ for any previous stores that might lead to forwarding
     auto store_it = load_inst->sqIt;
     assert (store_it >= storeWBIt);
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // No store in the SQ touches the load range, so none can forward.
+    if (!storeIndex.mayOverlap(req->mainRequest()->getVaddr(),
+                               req->mainRequest()->getSize())) {
+        store_it = storeWBIt;
+        ++lsqForwSearchSkipped;
+    }
+    int stores_searched = 0;
+    /// MPINHO 17-oct-2026 END ///
     // End once we've reached the top of the LSQ
     while (store_it != storeWBIt) {
         // Move the index to one younger
         store_it--;
+        ++stores_searched; /// MPINHO 17-oct-2026 ///
         assert(store_it->valid());
         assert(store_it->instruction()->seqNum < load_inst->seqNum);
         int store_size = store_it->size();
@@ -754,6 +872,9 @@ LSQUnit<Impl>::read(LSQRequest *req, int load_idx)
 
                 // Don't need to do anything special for split loads.
                 ++lsqForwLoads;
+                /// MPINHO 17-oct-2026 BEGIN ///
+                lsqForwSearchLength.sample(stores_searched);
+                /// MPINHO 17-oct-2026 END ///
 
                 return NoFault;
             } else if (
@@ -808,11 +929,16 @@ LSQUnit<Impl>::read(LSQRequest *req, int load_idx)
                 // Must discard the request.
                 req->discard();
                 load_req.setRequest(nullptr);
+                /// MPINHO 17-oct-2026 BEGIN ///
+                lsqForwSearchLength.sample(stores_searched);
+                /// MPINHO 17-oct-2026 END ///
                 return NoFault;
             }
         }
     }
 
+    lsqForwSearchLength.sample(stores_searched); /// MPINHO 17-oct-2026 ///
+
     // If there's no forwarding case, then go access memory
     DPRINTF(LSQUnit, "Doing memory access for inst [sn:%lli] PC %s\n",
             load_inst->seqNum, load_inst->pcState());
@@ -842,6 +968,8 @@ LSQUnit<Impl>::read(LSQRequest *req, int load_idx)
     if (!req->isSent())
         iewStage->blockMemInst(load_inst);
 
+    predictValue(load_inst, req->mainRequest()); /// MPINHO 17-oct-2026 ///
+
     return NoFault;
 }
 
@@ -859,6 +987,12 @@ LSQUnit<Impl>::write(LSQRequest *req, uint8_t *data, int store_idx)
     storeQueue[store_idx].setRequest(req);
     unsigned size = req->_size;
     storeQueue[store_idx].size() = size;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (size > 0) {
+        indexEntry(storeQueue[store_idx], storeIndex,
+                   storeQueue[store_idx].instruction()->effAddr, size);
+    }
+    /// MPINHO 17-oct-2026 END ///
     bool store_no_data =
         req->mainRequest()->getFlags() & Request::STORE_NO_DATA;
     storeQueue[store_idx].isAllZeros() = store_no_data;
@@ -48,6 +48,7 @@
 
 #include "arch/generic/debugfaults.hh"
 #include "arch/locked_mem.hh"
+#include "base/intmath.hh" /// MPINHO 17-oct-2026 ///
 #include "base/str.hh"
 #include "config/the_isa.hh"
 #include "cpu/checker/cpu.hh"
@@ -55,6 +56,7 @@
 #include "cpu/o3/lsq_unit.hh"
 #include "debug/Activity.hh"
 #include "debug/IEW.hh"
+#include "debug/LoadValuePred.hh" /// MPINHO 17-oct-2026 ///
 #include "debug/LSQUnit.hh"
 #include "debug/O3PipeView.hh"
 #include "mem/packet.hh"
@@ -169,6 +171,17 @@ LSQUnit<Impl>::init(O3CPU *cpu_ptr, IEW *iew_ptr, DerivO3CPUParams *params,
     checkLoads = params->LSQCheckLoads;
     needsTSO = params->needsTSO;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // Loads are matched in blocks of 2^depCheckShift bytes, so their
+    // granules can not be smaller. A few buckets per entry keep the
+    // buckets mostly free of aliasing.
+    unsigned index_shift = std::max(depCheckShift, 3u);
+    storeIndex.init(std::max(64, 1 << ceilLog2(4 * storeQueue.capacity())),
+                    index_shift);
+    loadIndex.init(std::max(64, 1 << ceilLog2(4 * loadQueue.capacity())),
+                   index_shift);
+    /// MPINHO 17-oct-2026 END ///
+
     resetState();
 }
 
@@ -185,6 +198,11 @@ LSQUnit<Impl>::resetState()
     retryPkt = NULL;
     memDepViolator = NULL;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    storeIndex.clear();
+    loadIndex.clear();
+    /// MPINHO 17-oct-2026 END ///
+
     stalled = false;
 
     cacheBlockMask = ~(cpu->cacheLineSize() - 1);
@@ -225,6 +243,68 @@ LSQUnit<Impl>::regStats()
         .name(name() + ".memOrderViolation")
         .desc("Number of memory ordering violations");
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    lsqForwSearchLength
+        .init(0, storeQueue.capacity(), std::max<int>(1,
+                                         storeQueue.capacity() / 16))
+        .name(name() + ".forwSearchLength")
+        .desc("Number of SQ entries examined per store to load forwarding "
+              "search")
+        .flags(Stats::pdf);
+
+    lsqForwSearchSkipped
+        .name(name() + ".forwSearchSkipped")
+        .desc("Number of forwarding searches skipped as no store in the SQ "
+              "touches the load address");
+
+    lsqViolSearchLength
+        .init(0, loadQueue.capacity(), std::max<int>(1,
+                                        loadQueue.capacity() / 16))
+        .name(name() + ".violSearchLength")
+        .desc("Number of LQ entries examined per memory ordering violation "
+              "search")
+        .flags(Stats::pdf);
+
+    lsqViolSearchSkipped
+        .name(name() + ".violSearchSkipped")
+        .desc("Number of violation searches skipped as no load in the LQ "
+              "touches the access address");
+
+    lvpEligible
+        .name(name() + ".lvpEligible")
+        .desc("Number of completed loads covered by the value predictor");
+
+    lvpCorrect
+        .name(name() + ".lvpCorrect")
+        .desc("Number of loads whose value was predicted correctly");
+
+    lvpIncorrect
+        .name(name() + ".lvpIncorrect")
+        .desc("Number of loads whose value was mispredicted");
+
+    lvpCoverage
+        .name(name() + ".lvpCoverage")
+        .desc("Fraction of the covered loads with a predicted value");
+    lvpCoverage = (lvpCorrect + lvpIncorrect) / lvpEligible;
+
+    lvpAccuracy
+        .name(name() + ".lvpAccuracy")
+        .desc("Fraction of the predicted load values that were correct");
+    lvpAccuracy = lvpCorrect / (lvpCorrect + lvpIncorrect);
+
+    lvpSquashedInsts
+        .name(name() + ".lvpSquashedInsts")
+        .desc("Number of instructions squashed by load value "
+              "mispredictions");
+
+    lvpRecoveryCycles
+        .init(0, 255, 16)
+        .name(name() + ".lvpRecoveryCycles")
+        .desc("Cycles from the prediction of a mispredicted load value to "
+              "its detection")
+        .flags(Stats::pdf);
+    /// MPINHO 17-oct-2026 END ///
+
     lsqSquashedStores
         .name(name() + ".squashedStores")
         .desc("Number of stores squashed");
@@ -446,6 +526,115 @@ LSQUnit<Impl>::checkSnoop(PacketPtr pkt)
     return;
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+void
+LSQUnit<Impl>::indexEntry(LSQEntry &entry, LSQAddrIndex &index, Addr addr,
+                          unsigned size)
+{
+    unindexEntry(entry, index);
+
+    index.insert(addr, size);
+    entry.setIndexed(addr, size);
+}
+
+template <class Impl>
+void
+LSQUnit<Impl>::unindexEntry(LSQEntry &entry, LSQAddrIndex &index)
+{
+    if (entry.indexed()) {
+        index.remove(entry.indexAddr(), entry.indexSize());
+        entry.clearIndexed();
+    }
+}
+
+template <class Impl>
+bool
+LSQUnit<Impl>::valuePredictable(const DynInstPtr &inst,
+                                const RequestPtr &req) const
+{
+    if (!lsq->valuePredictor().enabled())
+        return false;
+
+    if (inst->numDestRegs() != 1 || inst->isControl() ||
+        inst->isDataPrefetch() || inst->isInstPrefetch()) {
+        return false;
+    }
+
+    if (req->isLLSC() || req->isMmappedIpr() || req->isStrictlyOrdered())
+        return false;
+
+    PhysRegIdPtr dest = inst->renamedDestRegIdx(0);
+
+    return dest->isIntPhysReg() && !dest->isFixedMapping();
+}
+
+template <class Impl>
+void
+LSQUnit<Impl>::predictValue(const DynInstPtr &inst, const RequestPtr &req)
+{
+    // A load sent again after a blocked cache keeps its first prediction.
+    if (inst->valuePredicted || !valuePredictable(inst, req))
+        return;
+
+    uint64_t value;
+    if (!lsq->valuePredictor().lookup(valuePredKey(inst), value))
+        return;
+
+    DPRINTF(LoadValuePred, "Predicting value %#x for load [sn:%lli] "
+            "PC %s.\n", value, inst->seqNum, inst->pcState());
+
+    inst->valuePredicted = true;
+    inst->predValue = value;
+    inst->valuePredCycle = cpu->curCycle();
+
+    cpu->setIntReg(inst->renamedDestRegIdx(0), value);
+    iewStage->wakeValuePredicted(inst);
+}
+
+template <class Impl>
+void
+LSQUnit<Impl>::verifyValue(const DynInstPtr &inst, const RequestPtr &req)
+{
+    if (!valuePredictable(inst, req))
+        return;
+
+    uint64_t value = cpu->readIntReg(inst->renamedDestRegIdx(0));
+
+    ++lvpEligible;
+
+    if (inst->valuePredicted) {
+        if (value == inst->predValue) {
+            ++lvpCorrect;
+        } else {
+            DPRINTF(LoadValuePred, "Load [sn:%lli] PC %s loaded %#x, "
+                    "predicted %#x. Squashing.\n", inst->seqNum,
+                    inst->pcState(), value, inst->predValue);
+
+            ++lvpIncorrect;
+            lvpRecoveryCycles.sample(cpu->curCycle() - inst->valuePredCycle);
+
+            // Every younger instruction of the thread may have used the
+            // wrong value, and all of them are thrown away.
+            int squashed = 0;
+            for (auto it = cpu->instList.rbegin();
+                 it != cpu->instList.rend() &&
+                 (*it)->seqNum > inst->seqNum; ++it) {
+                if ((*it)->threadNumber == inst->threadNumber &&
+                    !(*it)->isSquashed()) {
+                    ++squashed;
+                }
+            }
+            lvpSquashedInsts += squashed;
+
+            iewStage->checkValueMisprediction(inst);
+        }
+    }
+
+    lsq->valuePredictor().update(valuePredKey(inst), value);
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 Fault
 LSQUnit<Impl>::checkViolations(typename LoadQueue::iterator& loadIt,
@@ -454,12 +643,22 @@ LSQUnit<Impl>::checkViolations(typename LoadQueue::iterator& loadIt,
     Addr inst_eff_addr1 = inst->effAddr >> depCheckShift;
     Addr inst_eff_addr2 = (inst->effAddr + inst->effSize - 1) >> depCheckShift;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // No younger load with a valid address touches the block range.
+    if (!loadIndex.mayOverlap(inst->effAddr, inst->effSize)) {
+        ++lsqViolSearchSkipped;
+        return NoFault;
+    }
+    int loads_searched = 0;
+    /// MPINHO 17-oct-2026 END ///
+
     /** @todo in theory you only need to check an instruction that has executed
      * however, there isn't a good way in the pipeline at the moment to check
      * all instructions that will execute before the store writes back. Thus,
      * like the implementation that came before it, we're overly conservative.
      */
     while (loadIt != loadQueue.end()) {
+        ++loads_searched; /// MPINHO 17-oct-2026 ///
         DynInstPtr ld_inst = loadIt->instruction();
         if (!ld_inst->effAddrValid() || ld_inst->strictlyOrdered()) {
             ++loadIt;
@@ -484,6 +683,9 @@ LSQUnit<Impl>::checkViolations(typename LoadQueue::iterator& loadIt,
                         memDepViolator = ld_inst;
 
                         ++lsqMemOrderViolation;
+                        /// MPINHO 17-oct-2026 BEGIN ///
+                        lsqViolSearchLength.sample(loads_searched);
+                        /// MPINHO 17-oct-2026 END ///
 
                         return std::make_shared<GenericISA::M5PanicFault>(
                             "Detected fault with inst [sn:%lli] and "
@@ -511,6 +713,9 @@ LSQUnit<Impl>::checkViolations(typename LoadQueue::iterator& loadIt,
                 memDepViolator = ld_inst;
 
                 ++lsqMemOrderViolation;
+                /// MPINHO 17-oct-2026 BEGIN ///
+                lsqViolSearchLength.sample(loads_searched);
+                /// MPINHO 17-oct-2026 END ///
 
                 return std::make_shared<GenericISA::M5PanicFault>(
                     "Detected fault with "
@@ -521,6 +726,7 @@ LSQUnit<Impl>::checkViolations(typename LoadQueue::iterator& loadIt,
 
         ++loadIt;
     }
+    lsqViolSearchLength.sample(loads_searched); /// MPINHO 17-oct-2026 ///
     return NoFault;
 }
 
@@ -569,10 +775,20 @@ LSQUnit<Impl>::executeLoad(const DynInstPtr &inst)
             ++it;
 
             if (checkLoads)
-                return checkViolations(it, inst);
+                /// MPINHO 17-oct-2026 BEGIN ///
+                load_fault = checkViolations(it, inst);
+                /// MPINHO 17-oct-2026 END ///
         }
     }
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // Indexed after its own violation check, as only younger loads are.
+    if (inst->effAddrValid()) {
+        indexEntry(loadQueue[inst->lqIdx], loadIndex, inst->effAddr,
+                   std::max<unsigned>(inst->effSize, 1));
+    }
+    /// MPINHO 17-oct-2026 END ///
+
     return load_fault;
 }
 
@@ -638,6 +854,7 @@ LSQUnit<Impl>::commitLoad()
     DPRINTF(LSQUnit, "Committing head load instruction, PC %s\n",
             loadQueue.front().instruction()->pcState());
 
+    unindexEntry(loadQueue.front(), loadIndex); /// MPINHO 17-oct-2026 ///
     loadQueue.front().clear();
     loadQueue.pop_front();
 
@@ -846,6 +1063,7 @@ LSQUnit<Impl>::squash(const InstSeqNum &squashed_num)
 
         // Clear the smart pointer to make sure it is decremented.
         loadQueue.back().instruction()->setSquashed();
+        unindexEntry(loadQueue.back(), loadIndex); /// MPINHO 17-oct-2026 ///
         loadQueue.back().clear();
 
         --loads;
@@ -885,6 +1103,7 @@ LSQUnit<Impl>::squash(const InstSeqNum &squashed_num)
         // Must delete request now that it wasn't handed off to
         // memory.  This is quite ugly.  @todo: Figure out the proper
         // place to really handle request deletes.
+        unindexEntry(storeQueue.back(), storeIndex); /// MPINHO 17-oct-2026 ///
         storeQueue.back().clear();
         --stores;
 
@@ -944,6 +1163,7 @@ LSQUnit<Impl>::writeback(const DynInstPtr &inst, PacketPtr pkt)
         if (inst->fault == NoFault) {
             // Complete access to copy data to proper place.
             inst->completeAcc(pkt);
+            verifyValue(inst, pkt->req); /// MPINHO 17-oct-2026 ///
         } else {
             // If the instruction has an outstanding fault, we cannot complete
             // the access as this discards the current fault.
@@ -984,6 +1204,9 @@ LSQUnit<Impl>::completeStore(typename StoreQueue::iterator store_idx)
     DynInstPtr store_inst = store_idx->instruction();
     if (store_idx == storeQueue.begin()) {
         do {
+            /// MPINHO 17-oct-2026 BEGIN ///
+            unindexEntry(storeQueue.front(), storeIndex);
+            /// MPINHO 17-oct-2026 END ///
             storeQueue.front().clear();
             storeQueue.pop_front();
             --stores;
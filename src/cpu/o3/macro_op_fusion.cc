@@ -0,0 +1,104 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+
+#include "cpu/o3/macro_op_fusion.hh"
+
+#include "base/bitfield.hh"
+#include "base/logging.hh"
+
+namespace
+{
+
+/** Whether an instruction is a plain AArch64 one. */
+bool
+isAArch64(ArmISA::ExtMachInst machInst)
+{
+    return machInst.aarch64 && !machInst.thumb && !machInst.decoderFault &&
+        !machInst.illegalExecution;
+}
+
+/** Whether an instruction only sets the flags, CMP, CMN or TST. */
+bool
+isFlagCompare(ArmISA::ExtMachInst machInst)
+{
+    if (bits(machInst, 4, 0) != 31)
+        return false;
+
+    // Add/sub (shifted or extended register), with S.
+    if (bits(machInst, 28, 24) == 0x0b && bits(machInst, 29))
+        return true;
+
+    // Add/sub (immediate), with S.
+    if (bits(machInst, 28, 23) == 0x22 && bits(machInst, 29))
+        return true;
+
+    // ANDS (shifted register or immediate).
+    if (bits(machInst, 30, 29) == 0x3 &&
+        (bits(machInst, 28, 24) == 0x0a || bits(machInst, 28, 23) == 0x24)) {
+        return true;
+    }
+
+    return false;
+}
+
+/** Whether an instruction is a conditional branch, B.cond. */
+bool
+isCondBranch(ArmISA::ExtMachInst machInst)
+{
+    return bits(machInst, 31, 24) == 0x54 && bits(machInst, 4) == 0;
+}
+
+/** Whether an instruction is ADRP. */
+bool
+isAdrp(ArmISA::ExtMachInst machInst)
+{
+    return bits(machInst, 31) && bits(machInst, 28, 24) == 0x10;
+}
+
+/** Whether an instruction is the 64-bit ADD (immediate). */
+bool
+isAddImm64(ArmISA::ExtMachInst machInst)
+{
+    return bits(machInst, 31, 23) == 0x122;
+}
+
+/** Whether an instruction is the AES one with the given opcode. */
+bool
+isAes(ArmISA::ExtMachInst machInst, uint8_t opcode)
+{
+    return bits(machInst, 31, 17) == 0x2714 &&
+        bits(machInst, 16, 12) == opcode && bits(machInst, 11, 10) == 0x2;
+}
+
+/** Whether the first source of tail is the destination of head. */
+bool
+readsResult(ArmISA::ExtMachInst head, ArmISA::ExtMachInst tail)
+{
+    return bits(tail, 9, 5) == bits(head, 4, 0);
+}
+
+} // anonymous namespace
+
+bool
+fusesWith(MacroOpFusionPair pair, ArmISA::ExtMachInst head,
+          ArmISA::ExtMachInst tail)
+{
+    if (!isAArch64(head) || !isAArch64(tail))
+        return false;
+
+    switch (pair) {
+      case MacroOpFusionPair::CmpBranch:
+        return isFlagCompare(head) && isCondBranch(tail);
+      case MacroOpFusionPair::AdrpAdd:
+        return isAdrp(head) && isAddImm64(tail) && readsResult(head, tail);
+      case MacroOpFusionPair::AeseAesmc:
+        return isAes(head, 0x04) && isAes(tail, 0x06) &&
+            readsResult(head, tail);
+      case MacroOpFusionPair::AesdAesimc:
+        return isAes(head, 0x05) && isAes(tail, 0x07) &&
+            readsResult(head, tail);
+      default:
+        panic("Unknown macro-op fusion pair (%d).", static_cast<int>(pair));
+    }
+}
+
+/// MPINHO 17-oct-2026 END ///
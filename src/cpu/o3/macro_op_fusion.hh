@@ -0,0 +1,31 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+#ifndef __CPU_O3_MACRO_OP_FUSION_HH__
+#define __CPU_O3_MACRO_OP_FUSION_HH__
+
+#include "arch/types.hh"
+#include "enums/MacroOpFusionPair.hh"
+
+/**
+ * Checks if two consecutive instructions form one of the pairs that decode
+ * fuses into a single macro-op.
+ *
+ * Only AArch64 encodings are decoded:
+ * - CmpBranch: CMP, CMN or TST (flag setting ADD/SUB/AND to XZR) followed
+ *   by B.cond;
+ * - AdrpAdd: ADRP followed by a 64-bit ADD immediate of its result;
+ * - AeseAesmc, AesdAesimc: an AES round followed by the (inverse) mix
+ *   columns of its result.
+ *
+ * Micro-ops carry the encoding of their macro-op, so they must be left
+ * out by the caller.
+ *
+ * @param pair The pair to check.
+ * @param head The encoding of the older instruction.
+ * @param tail The encoding of the younger instruction, that directly
+ *             follows head.
+ */
+bool fusesWith(MacroOpFusionPair pair, ArmISA::ExtMachInst head,
+               ArmISA::ExtMachInst tail);
+
+#endif // __CPU_O3_MACRO_OP_FUSION_HH__
+/// MPINHO 17-oct-2026 END ///
@@ -0,0 +1,152 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "cpu/o3/macro_op_fusion.hh"
+
+namespace
+{
+
+/** Encodings, as given by an assembler. */
+const uint32_t CmpReg = 0xeb02003f;     // cmp x1, x2
+const uint32_t CmpImm = 0xf100103f;     // cmp x1, #4
+const uint32_t CmpW = 0x6b02003f;       // cmp w1, w2
+const uint32_t CmnReg = 0xab02003f;     // cmn x1, x2
+const uint32_t CmnImm = 0xb100103f;     // cmn x1, #4
+const uint32_t TstReg = 0xea02003f;     // tst x1, x2
+const uint32_t TstImm = 0xf240003f;     // tst x1, #0x1
+const uint32_t Subs = 0xeb020023;       // subs x3, x1, x2
+const uint32_t SubXzr = 0xcb02003f;     // sub xzr, x1, x2
+const uint32_t Ands = 0xea020023;       // ands x3, x1, x2
+const uint32_t BEq = 0x54000040;        // b.eq #8
+const uint32_t BNe = 0x54000041;        // b.ne #8
+const uint32_t BcEq = 0x54000050;       // bc.eq #8
+const uint32_t B = 0x14000002;          // b #8
+const uint32_t Cbz = 0xb4000040;        // cbz x0, #8
+const uint32_t Adrp = 0x90000000;       // adrp x0, #0
+const uint32_t Adr = 0x10000000;        // adr x0, #0
+const uint32_t AddX0 = 0x91004000;      // add x0, x0, #16
+const uint32_t AddX1 = 0x91004020;      // add x0, x1, #16
+const uint32_t AddW0 = 0x11004000;      // add w0, w0, #16
+const uint32_t AddsX0 = 0xb1004000;     // adds x0, x0, #16
+const uint32_t Aese = 0x4e284820;       // aese v0.16b, v1.16b
+const uint32_t Aesmc = 0x4e286800;      // aesmc v0.16b, v0.16b
+const uint32_t AesmcV1 = 0x4e286821;    // aesmc v1.16b, v1.16b
+const uint32_t Aesd = 0x4e285820;       // aesd v0.16b, v1.16b
+const uint32_t Aesimc = 0x4e287800;     // aesimc v0.16b, v0.16b
+const uint32_t AesimcV2 = 0x4e287842;   // aesimc v2.16b, v2.16b
+
+/** Decoder view of an AArch64 encoding. */
+ArmISA::ExtMachInst
+a64(uint32_t enc)
+{
+    ArmISA::ExtMachInst emi = 0;
+    emi.instBits = enc;
+    emi.aarch64 = 1;
+    return emi;
+}
+
+bool
+fuses(MacroOpFusionPair pair, uint32_t head, uint32_t tail)
+{
+    return fusesWith(pair, a64(head), a64(tail));
+}
+
+} // anonymous namespace
+
+TEST(MacroOpFusionTest, CmpBranch)
+{
+    const MacroOpFusionPair pair = MacroOpFusionPair::CmpBranch;
+
+    for (uint32_t cmp : {CmpReg, CmpImm, CmpW, CmnReg, CmnImm, TstReg,
+                         TstImm}) {
+        EXPECT_TRUE(fuses(pair, cmp, BEq)) << std::hex << cmp;
+        EXPECT_TRUE(fuses(pair, cmp, BNe)) << std::hex << cmp;
+    }
+
+    // Instructions writing a register as well as the flags, or not
+    // setting the flags.
+    for (uint32_t alu : {Subs, SubXzr, Ands, AddsX0})
+        EXPECT_FALSE(fuses(pair, alu, BEq)) << std::hex << alu;
+
+    // BC.cond, and other branches.
+    for (uint32_t branch : {BcEq, B, Cbz})
+        EXPECT_FALSE(fuses(pair, CmpReg, branch)) << std::hex << branch;
+
+    EXPECT_FALSE(fuses(pair, BEq, CmpReg));
+}
+
+TEST(MacroOpFusionTest, AdrpAdd)
+{
+    const MacroOpFusionPair pair = MacroOpFusionPair::AdrpAdd;
+
+    EXPECT_TRUE(fuses(pair, Adrp, AddX0));
+
+    // ADD of a different register.
+    EXPECT_FALSE(fuses(pair, Adrp, AddX1));
+    // 32-bit ADD, ADDS.
+    EXPECT_FALSE(fuses(pair, Adrp, AddW0));
+    EXPECT_FALSE(fuses(pair, Adrp, AddsX0));
+    // ADR.
+    EXPECT_FALSE(fuses(pair, Adr, AddX0));
+    EXPECT_FALSE(fuses(pair, AddX0, Adrp));
+}
+
+TEST(MacroOpFusionTest, AeseAesmc)
+{
+    const MacroOpFusionPair pair = MacroOpFusionPair::AeseAesmc;
+
+    EXPECT_TRUE(fuses(pair, Aese, Aesmc));
+
+    // AESMC of a different register.
+    EXPECT_FALSE(fuses(pair, Aese, AesmcV1));
+    // Other AES instructions.
+    EXPECT_FALSE(fuses(pair, Aese, Aesimc));
+    EXPECT_FALSE(fuses(pair, Aesd, Aesmc));
+    EXPECT_FALSE(fuses(pair, Aesmc, Aese));
+}
+
+TEST(MacroOpFusionTest, AesdAesimc)
+{
+    const MacroOpFusionPair pair = MacroOpFusionPair::AesdAesimc;
+
+    EXPECT_TRUE(fuses(pair, Aesd, Aesimc));
+
+    // AESIMC of a different register.
+    EXPECT_FALSE(fuses(pair, Aesd, AesimcV2));
+    // Other AES instructions.
+    EXPECT_FALSE(fuses(pair, Aesd, Aesmc));
+    EXPECT_FALSE(fuses(pair, Aese, Aesimc));
+    EXPECT_FALSE(fuses(pair, Aesimc, Aesd));
+}
+
+TEST(MacroOpFusionTest, OtherPairs)
+{
+    // Each pair only fuses its own instructions.
+    EXPECT_FALSE(fuses(MacroOpFusionPair::AdrpAdd, CmpReg, BEq));
+    EXPECT_FALSE(fuses(MacroOpFusionPair::CmpBranch, Adrp, AddX0));
+    EXPECT_FALSE(fuses(MacroOpFusionPair::AesdAesimc, Aese, Aesmc));
+    EXPECT_FALSE(fuses(MacroOpFusionPair::AeseAesmc, Aesd, Aesimc));
+}
+
+TEST(MacroOpFusionTest, NotAArch64)
+{
+    ArmISA::ExtMachInst head = a64(CmpReg);
+    ArmISA::ExtMachInst tail = a64(BEq);
+    const MacroOpFusionPair pair = MacroOpFusionPair::CmpBranch;
+
+    ArmISA::ExtMachInst aarch32 = tail;
+    aarch32.aarch64 = 0;
+    EXPECT_FALSE(fusesWith(pair, head, aarch32));
+
+    ArmISA::ExtMachInst thumb = tail;
+    thumb.thumb = 1;
+    EXPECT_FALSE(fusesWith(pair, head, thumb));
+
+    ArmISA::ExtMachInst fault = head;
+    fault.decoderFault = 1;
+    EXPECT_FALSE(fusesWith(pair, fault, tail));
+}
+/// MPINHO 17-oct-2026 END ///
@@ -165,7 +165,10 @@ class MemDepUnit
     void dumpLists();
 
   private:
-    typedef typename std::list<DynInstPtr>::iterator ListIt;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    typedef typename Impl::DynInstList DynInstList;
+    typedef typename DynInstList::iterator ListIt;
+    /// MPINHO 17-oct-2026 END ///
 
     class MemDepEntry;
 
@@ -247,10 +250,10 @@ class MemDepUnit
     MemDepHash memDepHash;
 
     /** A list of all instructions in the memory dependence unit. */
-    std::list<DynInstPtr> instList[Impl::MaxThreads];
+    DynInstList instList[Impl::MaxThreads]; /// MPINHO 17-oct-2026 ///
 
     /** A list of all instructions that are going to be replayed. */
-    std::list<DynInstPtr> instsToReplay;
+    DynInstList instsToReplay; /// MPINHO 17-oct-2026 ///
 
     /** The memory dependence predictor.  It is accessed upon new
      *  instructions being added to the IQ, and responds by telling
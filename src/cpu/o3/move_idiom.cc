@@ -0,0 +1,98 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+
+#include "cpu/o3/move_idiom.hh"
+
+#include "arch/types.hh"
+#include "base/bitfield.hh"
+#include "cpu/static_inst.hh"
+
+MoveIdiom
+decodeMoveIdiom(const StaticInstPtr &inst)
+{
+    ArmISA::ExtMachInst machInst = inst->machInst;
+
+    if (machInst.decoderFault || machInst.illegalExecution ||
+        machInst.thumb || !machInst.aarch64) {
+        return MoveIdiom::None;
+    }
+
+    uint8_t sf = bits(machInst, 31);
+    uint8_t rn = bits(machInst, 9, 5);
+    uint8_t rm = bits(machInst, 20, 16);
+    bool no_shift = bits(machInst, 15, 10) == 0;
+
+    if (bits(machInst, 28, 24) == 0x0a && bits(machInst, 21) == 0) {
+        // Logical (shifted register), second operand not inverted.
+        switch (bits(machInst, 30, 29)) {
+          case 0x0:
+            // AND with XZR.
+            if (rn == 31 || rm == 31)
+                return MoveIdiom::Zero;
+            break;
+          case 0x1:
+            // ORR of XZR with itself, or MOV Xd, Xm. The 32-bit move
+            // clears the upper half, so it is not a copy.
+            if (rn == 31 && rm == 31)
+                return MoveIdiom::Zero;
+            if (rn == 31 && no_shift && sf)
+                return MoveIdiom::Move;
+            break;
+          case 0x2:
+            // EOR of a register with itself.
+            if (rn == rm && no_shift)
+                return MoveIdiom::Zero;
+            break;
+          default:
+            // ANDS also writes the flags.
+            break;
+        }
+        return MoveIdiom::None;
+    }
+
+    if (bits(machInst, 28, 24) == 0x0b && bits(machInst, 21) == 0) {
+        // Add/sub (shifted register): SUB of a register with itself.
+        if (bits(machInst, 30, 29) == 0x2 && rn == rm && no_shift)
+            return MoveIdiom::Zero;
+        return MoveIdiom::None;
+    }
+
+    if (bits(machInst, 28, 23) == 0x22) {
+        // Add/sub (immediate): ADD #0, the move to or from SP.
+        if (sf && bits(machInst, 30, 29) == 0x0 &&
+            bits(machInst, 21, 10) == 0) {
+            return MoveIdiom::Move;
+        }
+        return MoveIdiom::None;
+    }
+
+    if (bits(machInst, 28, 23) == 0x25) {
+        // Move wide (immediate): MOVZ #0, which clears the whole register
+        // in both sizes.
+        if (bits(machInst, 30, 29) == 0x2 && bits(machInst, 20, 5) == 0)
+            return MoveIdiom::Zero;
+        return MoveIdiom::None;
+    }
+
+    if (bits(machInst, 31) == 0 && bits(machInst, 15, 10) == 0x07) {
+        // AdvSIMD three same, logical.
+        switch (bits(machInst, 29, 21)) {
+          case 0x075:
+            // ORR of a register with itself, MOV Vd.T, Vn.T. Only the
+            // 128-bit form, as the 64-bit one clears the upper half.
+            if (bits(machInst, 30) && rn == rm)
+                return MoveIdiom::Move;
+            break;
+          case 0x171:
+            // EOR of a register with itself.
+            if (rn == rm)
+                return MoveIdiom::Zero;
+            break;
+          default:
+            break;
+        }
+    }
+
+    return MoveIdiom::None;
+}
+
+/// MPINHO 17-oct-2026 END ///
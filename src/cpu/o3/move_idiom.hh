@@ -0,0 +1,33 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+#ifndef __CPU_O3_MOVE_IDIOM_HH__
+#define __CPU_O3_MOVE_IDIOM_HH__
+
+#include "cpu/static_inst_fwd.hh"
+
+/** Register idioms that rename can complete without executing. */
+enum class MoveIdiom
+{
+    /** Not an idiom, the instruction must execute. */
+    None,
+    /** Copies its only source register to its destination. */
+    Move,
+    /** Writes zero to its destination, whatever its sources hold. */
+    Zero
+};
+
+/**
+ * Recognizes register to register moves and zeroing idioms.
+ *
+ * Only AArch64 encodings are decoded:
+ * - moves: MOV Xd, Xm (ORR with XZR), MOV to or from SP (ADD #0) and
+ *   MOV Vd.16B, Vn.16B (ORR with the same register);
+ * - zero idioms: EOR/SUB of a register with itself, AND/ORR with XZR,
+ *   MOVZ #0 and EOR Vd, Vn, Vn.
+ *
+ * 32-bit and 64-bit vector moves are left out, as they clear the upper
+ * bits of the destination.
+ */
+MoveIdiom decodeMoveIdiom(const StaticInstPtr &inst);
+
+#endif // __CPU_O3_MOVE_IDIOM_HH__
+/// MPINHO 17-oct-2026 END ///
@@ -46,10 +46,12 @@
 
 #include <list>
 #include <utility>
+#include <vector> /// MPINHO 17-oct-2026
 
 #include "base/statistics.hh"
 #include "config/the_isa.hh"
 #include "cpu/timebuf.hh"
+#include "cpu/width_board.hh" /// MPINHO 17-oct-2026
 #include "sim/probe/probe.hh"
 
 struct DerivO3CPUParams;
@@ -184,6 +186,33 @@ class DefaultRename
     /** Sets pointer to the scoreboard. */
     void setScoreboard(Scoreboard *_scoreboard);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Sets pointer to the precision board. */
+    void setPrecisionBoard(PrecisionBoard *_precBoard);
+
+    /**
+     * Whether a physical register has more than one rename mapping, after
+     * move elimination. The zero register is shared by every zeroing
+     * idiom.
+     */
+    bool
+    isSharedReg(PhysRegIdPtr phys_reg) const
+    {
+        return phys_reg->isZeroReg() || freeList->isShared(phys_reg);
+    }
+
+    /**
+     * Moves the committed mapping of an architectural register off a
+     * shared physical register, onto a free one, so it can be written in
+     * place. The rename map and the oldest rename history of the register
+     * are updated to match. The caller copies the value and updates the
+     * committed rename map.
+     * @return The new physical register.
+     */
+    PhysRegIdPtr unshareArchReg(const RegId &arch_reg, PhysRegIdPtr phys_reg,
+                                ThreadID tid);
+    /// MPINHO 17-oct-2026 END ///
+
     /** Perform sanity checks after a drain. */
     void drainSanityCheck() const;
 
@@ -260,6 +289,17 @@ class DefaultRename
     /** Renames the destination registers of an instruction. */
     inline void renameDestRegs(const DynInstPtr &inst, ThreadID tid);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Renames the destination of a move or zeroing idiom onto the register
+     * of its source, or onto the zero register, so it needs no execution.
+     * Must be called after the sources are renamed.
+     * @return Whether the instruction was eliminated. Otherwise its
+     * destinations are left to renameDestRegs().
+     */
+    bool eliminateMove(const DynInstPtr &inst, ThreadID tid);
+    /// MPINHO 17-oct-2026 END ///
+
     /** Calculates the number of free ROB entries for a specific thread. */
     inline int calcFreeROBEntries(ThreadID tid);
 
@@ -370,6 +410,46 @@ class DefaultRename
     /** Pointer to the scoreboard. */
     Scoreboard *scoreboard;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Pointer to the precision board. */
+    PrecisionBoard *precBoard;
+
+    /** Returns a physical register to the free list. */
+    void freePhysReg(PhysRegIdPtr phys_reg);
+
+    /**
+     * Whether vector destinations are allocated in register slices,
+     * according to their predicted width.
+     */
+    bool widthAwareRename;
+
+    /** Slices last needed by the vector results of each PC. */
+    std::vector<uint8_t> slicePredictor;
+
+    /** Mask to index the slice predictor. */
+    Addr slicePredictorMask;
+
+    /** PC of the instruction each physical vector register was renamed
+     * for, to train the slice predictor. */
+    std::vector<Addr> vecRegPC;
+
+    /** Whether moves and zeroing idioms are eliminated at rename. */
+    bool moveElimination;
+
+    /** Returns the slices predicted for the vector results of an inst. */
+    int predictVecSlices(const DynInstPtr &inst) const;
+
+    /** Checks if there are enough free slices for an inst and its fused
+     * tail, if any. */
+    bool canRenameVecSlices(const DynInstPtr &inst,
+                            const DynInstPtr &tail) const;
+
+    /** Checks if there are enough free registers for an inst and its fused
+     * tail, if any. */
+    bool canRenameRegs(const DynInstPtr &inst, const DynInstPtr &tail,
+                       ThreadID tid) const;
+    /// MPINHO 17-oct-2026 END ///
+
     /** Count of instructions in progress that have been sent off to the IQ
      * and ROB, but are not yet included in their occupancy counts.
      */
@@ -385,6 +465,13 @@ class DefaultRename
      */
     int storesInProgress[Impl::MaxThreads];
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Count of fused tails in progress, included in instsInProgress but
+     * taking no ROB or IQ entry of their own.
+     */
+    int fusedInProgress[Impl::MaxThreads];
+    /// MPINHO 17-oct-2026 END ///
+
     /** Variable that tracks if decode has written to the time buffer this
      * cycle. Used to tell CPU if there is activity this cycle.
      */
@@ -528,6 +615,29 @@ class DefaultRename
     Stats::Scalar renamedTempSerializing;
     /** Number of instructions inserted into skid buffers. */
     Stats::Scalar renameSkidInsts;
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Stat for total number of times that rename runs out of free vector
+     * register slices. */
+    Stats::Scalar renameFullVecSlicesEvents;
+    /** Fused pairs whose tail was left for a later cycle. */
+    Stats::Scalar renameSplitFusedPairs;
+    /** Slices predicted for each renamed vector destination. */
+    Stats::Distribution renameVecSlicesPredicted;
+    /** Vector results that needed more slices than predicted. */
+    Stats::Scalar renameVecSliceUnderpredicts;
+    /** Vector results that needed less slices than predicted. */
+    Stats::Scalar renameVecSliceOverpredicts;
+    /** Vector results that needed the predicted slices. */
+    Stats::Scalar renameVecSliceCorrect;
+
+    /** Number of moves renamed onto the register of their source. */
+    Stats::Scalar renameMovesEliminated;
+    /** Number of zeroing idioms renamed onto the zero register. */
+    Stats::Scalar renameZeroIdiomsEliminated;
+    /** Fraction of the renamed instructions that were eliminated. */
+    Stats::Formula renameElimRate;
+    /// MPINHO 17-oct-2026 END ///
 };
 
 #endif // __CPU_O3_RENAME_HH__
@@ -49,7 +49,9 @@
 
 #include "arch/isa_traits.hh"
 #include "arch/registers.hh"
+#include "base/intmath.hh" /// MPINHO 17-oct-2026
 #include "config/the_isa.hh"
+#include "cpu/o3/move_idiom.hh" /// MPINHO 17-oct-2026
 #include "cpu/o3/rename.hh"
 #include "cpu/reg_class.hh"
 #include "debug/Activity.hh"
@@ -77,12 +79,26 @@ DefaultRename<Impl>::DefaultRename(O3CPU *_cpu, DerivO3CPUParams *params)
 
     // @todo: Make into a parameter.
     skidBufferMax = (decodeToRenameDelay + 1) * params->decodeWidth;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    precBoard = nullptr;
+
+    widthAwareRename = params->widthAwareRename;
+    if (!isPowerOf2(params->widthRenamePredictorSize)) {
+        fatal("Invalid slice predictor size (%u), must be a power of 2.\n",
+              params->widthRenamePredictorSize);
+    }
+    slicePredictor.resize(params->widthRenamePredictorSize, 0);
+    slicePredictorMask = params->widthRenamePredictorSize - 1;
+
+    moveElimination = params->moveElimination;
+    /// MPINHO 17-oct-2026 END ///
     for (uint32_t tid = 0; tid < Impl::MaxThreads; tid++) {
         renameStatus[tid] = Idle;
         renameMap[tid] = nullptr;
         instsInProgress[tid] = 0;
         loadsInProgress[tid] = 0;
         storesInProgress[tid] = 0;
+        fusedInProgress[tid] = 0; /// MPINHO 17-oct-2026 ///
         freeEntries[tid] = {0, 0, 0, 0};
         emptyROB[tid] = true;
         stalls[tid] = {false, false};
@@ -201,6 +217,52 @@ DefaultRename<Impl>::regStats()
         .name(name() + ".vec_pred_rename_lookups")
         .desc("Number of vector predicate rename lookups")
         .prereq(vecPredRenameLookups);
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    renameFullVecSlicesEvents
+        .name(name() + ".FullVecSliceEvents")
+        .desc("Number of times there has been no free vector register"
+              " slices")
+        .prereq(renameFullVecSlicesEvents);
+    renameSplitFusedPairs
+        .name(name() + ".SplitFusedPairs")
+        .desc("Number of fused pairs whose tail was renamed in a later"
+              " cycle than its head")
+        .prereq(renameSplitFusedPairs);
+    renameVecSlicesPredicted
+        .init(1, PrecisionBoard::NumSlices, 1)
+        .name(name() + ".vec_slices_predicted")
+        .desc("Slices predicted for each renamed vector destination")
+        .flags(Stats::pdf);
+    renameVecSliceUnderpredicts
+        .name(name() + ".vec_slice_underpredicts")
+        .desc("Number of vector results that needed more slices than"
+              " predicted")
+        .prereq(renameVecSliceUnderpredicts);
+    renameVecSliceOverpredicts
+        .name(name() + ".vec_slice_overpredicts")
+        .desc("Number of vector results that needed less slices than"
+              " predicted")
+        .prereq(renameVecSliceOverpredicts);
+    renameVecSliceCorrect
+        .name(name() + ".vec_slice_correct")
+        .desc("Number of vector results that needed the predicted slices")
+        .prereq(renameVecSliceCorrect);
+    renameMovesEliminated
+        .name(name() + ".MovesEliminated")
+        .desc("Number of moves renamed onto the register of their source")
+        .prereq(renameMovesEliminated);
+    renameZeroIdiomsEliminated
+        .name(name() + ".ZeroIdiomsEliminated")
+        .desc("Number of zeroing idioms renamed onto the zero register")
+        .prereq(renameZeroIdiomsEliminated);
+    renameElimRate
+        .name(name() + ".ElimRate")
+        .desc("Fraction of the renamed instructions that were eliminated")
+        .precision(6);
+    renameElimRate = (renameMovesEliminated + renameZeroIdiomsEliminated) /
+        renameRenamedInsts;
+    /// MPINHO 17-oct-2026 END ///
 }
 
 template <class Impl>
@@ -273,6 +335,7 @@ DefaultRename<Impl>::clearStates(ThreadID tid)
     instsInProgress[tid] = 0;
     loadsInProgress[tid] = 0;
     storesInProgress[tid] = 0;
+    fusedInProgress[tid] = 0; /// MPINHO 17-oct-2026 ///
 
     serializeOnNextInst[tid] = false;
 }
@@ -302,6 +365,7 @@ DefaultRename<Impl>::resetStage()
         instsInProgress[tid] = 0;
         loadsInProgress[tid] = 0;
         storesInProgress[tid] = 0;
+        fusedInProgress[tid] = 0; /// MPINHO 17-oct-2026 ///
 
         serializeOnNextInst[tid] = false;
     }
@@ -337,6 +401,177 @@ DefaultRename<Impl>::setScoreboard(Scoreboard *_scoreboard)
     scoreboard = _scoreboard;
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template<class Impl>
+void
+DefaultRename<Impl>::setPrecisionBoard(PrecisionBoard *_precBoard)
+{
+    precBoard = _precBoard;
+
+    vecRegPC.resize(precBoard->numVecRegs(), MaxAddr);
+}
+
+template<class Impl>
+void
+DefaultRename<Impl>::freePhysReg(PhysRegIdPtr phys_reg)
+{
+    // The zero register is shared by every zeroing idiom and is never
+    // freed, other registers only with their last mapping.
+    if (phys_reg->isZeroReg() || !freeList->unshareReg(phys_reg))
+        return;
+
+    if (precBoard && phys_reg->isVectorPhysReg()) {
+        if (widthAwareRename) {
+            int predicted = precBoard->getPredictedSlicesVecReg(phys_reg);
+            Addr pc = vecRegPC[phys_reg->index()];
+
+            // Train the predictor with the slices the value needed, if it
+            // was written back.
+            if (pc != MaxAddr && precBoard->hasWidthVecReg(phys_reg)) {
+                int slices = precBoard->getSlicesVecReg(phys_reg);
+
+                if (slices > predicted) {
+                    ++renameVecSliceUnderpredicts;
+                } else if (slices < predicted) {
+                    ++renameVecSliceOverpredicts;
+                } else {
+                    ++renameVecSliceCorrect;
+                }
+
+                slicePredictor[(pc >> 2) & slicePredictorMask] = slices;
+            }
+
+            vecRegPC[phys_reg->index()] = MaxAddr;
+            precBoard->releaseSlicesVecReg(phys_reg);
+        }
+
+        // The width of a free register is meaningless.
+        precBoard->clearWidthVecReg(phys_reg);
+    }
+
+    freeList->addReg(phys_reg);
+}
+
+template<class Impl>
+PhysRegIdPtr
+DefaultRename<Impl>::unshareArchReg(const RegId &arch_reg,
+                                    PhysRegIdPtr phys_reg, ThreadID tid)
+{
+    PhysRegIdPtr new_reg;
+
+    switch (arch_reg.classValue()) {
+      case IntRegClass:
+        panic_if(!freeList->hasFreeIntRegs(), "No free integer register "
+                 "to unshare arch reg %i.", arch_reg.index());
+        new_reg = freeList->getIntReg();
+        break;
+      case FloatRegClass:
+        panic_if(!freeList->hasFreeFloatRegs(), "No free fp register "
+                 "to unshare arch reg %i.", arch_reg.index());
+        new_reg = freeList->getFloatReg();
+        break;
+      case VecRegClass:
+        panic_if(!freeList->hasFreeVecRegs(), "No free vector register "
+                 "to unshare arch reg %i.", arch_reg.index());
+        new_reg = freeList->getVecReg();
+        // Nothing is known about the width of the value.
+        if (widthAwareRename) {
+            precBoard->reserveSlicesVecReg(new_reg,
+                                           PrecisionBoard::NumSlices);
+        }
+        break;
+      default:
+        panic("Unexpected shared register class (%s).",
+              arch_reg.className());
+    }
+
+    DPRINTF(Rename, "[tid:%u]: Unsharing arch reg %i (%s) from physical "
+            "reg %i, now mapped to %i.\n", tid, arch_reg.index(),
+            arch_reg.className(), phys_reg->flatIndex(),
+            new_reg->flatIndex());
+
+    // The oldest in-flight renames of the register, if any, restore the
+    // committed mapping on a squash and free it on commit. Renames that
+    // kept the mapping, like moves onto themselves, are followed through.
+    for (auto hb_it = historyBuffer[tid].rbegin();
+         hb_it != historyBuffer[tid].rend(); ++hb_it) {
+        if (hb_it->archReg != arch_reg)
+            continue;
+
+        if (hb_it->prevPhysReg != phys_reg)
+            break;
+
+        hb_it->prevPhysReg = new_reg;
+
+        if (hb_it->newPhysReg != phys_reg)
+            break;
+
+        hb_it->newPhysReg = new_reg;
+    }
+
+    if (renameMap[tid]->lookup(arch_reg) == phys_reg)
+        renameMap[tid]->setEntry(arch_reg, new_reg);
+
+    scoreboard->setReg(new_reg);
+
+    // Drop the mapping that moved to the new register. Other mappings
+    // remain, so the old register is not freed.
+    if (!phys_reg->isZeroReg())
+        freeList->unshareReg(phys_reg);
+
+    return new_reg;
+}
+
+template<class Impl>
+int
+DefaultRename<Impl>::predictVecSlices(const DynInstPtr &inst) const
+{
+    int slices = slicePredictor[(inst->instAddr() >> 2) & slicePredictorMask];
+
+    // Without history, assume the whole register is needed.
+    return slices ? slices : PrecisionBoard::NumSlices;
+}
+
+template<class Impl>
+bool
+DefaultRename<Impl>::canRenameVecSlices(const DynInstPtr &inst,
+                                        const DynInstPtr &tail) const
+{
+    if (!widthAwareRename)
+        return true;
+
+    unsigned needed = inst->numVecDestRegs() * predictVecSlices(inst);
+    if (tail)
+        needed += tail->numVecDestRegs() * predictVecSlices(tail);
+
+    return needed <= precBoard->numFreeSlices();
+}
+
+template<class Impl>
+bool
+DefaultRename<Impl>::canRenameRegs(const DynInstPtr &inst,
+                                   const DynInstPtr &tail,
+                                   ThreadID tid) const
+{
+    if (!tail) {
+        return renameMap[tid]->canRename(inst->numIntDestRegs(),
+                                         inst->numFPDestRegs(),
+                                         inst->numVecDestRegs(),
+                                         inst->numVecElemDestRegs(),
+                                         inst->numVecPredDestRegs(),
+                                         inst->numCCDestRegs());
+    }
+
+    return renameMap[tid]->canRename(
+        inst->numIntDestRegs() + tail->numIntDestRegs(),
+        inst->numFPDestRegs() + tail->numFPDestRegs(),
+        inst->numVecDestRegs() + tail->numVecDestRegs(),
+        inst->numVecElemDestRegs() + tail->numVecElemDestRegs(),
+        inst->numVecPredDestRegs() + tail->numVecPredDestRegs(),
+        inst->numCCDestRegs() + tail->numCCDestRegs());
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 bool
 DefaultRename<Impl>::isDrained() const
@@ -479,6 +714,10 @@ DefaultRename<Impl>::tick()
         instsInProgress[tid] -= fromIEW->iewInfo[tid].dispatched;
         loadsInProgress[tid] -= fromIEW->iewInfo[tid].dispatchedToLQ;
         storesInProgress[tid] -= fromIEW->iewInfo[tid].dispatchedToSQ;
+        /// MPINHO 17-oct-2026 BEGIN ///
+        fusedInProgress[tid] -= fromIEW->iewInfo[tid].dispatchedFused;
+        assert(fusedInProgress[tid] >= 0);
+        /// MPINHO 17-oct-2026 END ///
         assert(loadsInProgress[tid] >= 0);
         assert(storesInProgress[tid] >= 0);
         assert(instsInProgress[tid] >=0);
@@ -628,7 +867,19 @@ DefaultRename<Impl>::renameInsts(ThreadID tid)
 
     int renamed_insts = 0;
 
-    while (insts_available > 0 &&  toIEWIndex < renameWidth) {
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // The tail of a fused pair does not take a slot of its own, nor a ROB
+    // or IQ entry, and is renamed in the same cycle as its head even if
+    // the width or the free entries are exhausted by then.
+    unsigned fused_insts = 0;
+    // Tail of the last head renamed, until it is renamed too.
+    DynInstPtr pending_tail;
+
+    while (toIEWIndex < Impl::MaxWidth &&
+           (pending_tail ||
+            (insts_available > 0 &&
+             toIEWIndex - fused_insts < renameWidth))) {
+    /// MPINHO 17-oct-2026 END ///
         DPRINTF(Rename, "[tid:%u]: Sending instructions to IEW.\n", tid);
 
         assert(!insts_to_rename.empty());
@@ -674,20 +925,27 @@ DefaultRename<Impl>::renameInsts(ThreadID tid)
             // Decrement how many instructions are available.
             --insts_available;
 
+            pending_tail = nullptr; /// MPINHO 17-oct-2026 ///
+
             continue;
         }
 
         DPRINTF(Rename, "[tid:%u]: Processing instruction [sn:%lli] with "
                 "PC %s.\n", tid, inst->seqNum, inst->pcState());
 
+        /// MPINHO 17-oct-2026 BEGIN ///
+        // The head of a fused pair also needs the resources of its tail,
+        // so that the pair is not split by a stall.
+        DynInstPtr tail;
+        if (!inst->fusedTail && !insts_to_rename.empty() &&
+            insts_to_rename.front()->fusedTail) {
+            tail = insts_to_rename.front();
+        }
+        /// MPINHO 17-oct-2026 END ///
+
         // Check here to make sure there are enough destination registers
         // to rename to.  Otherwise block.
-        if (!renameMap[tid]->canRename(inst->numIntDestRegs(),
-                                       inst->numFPDestRegs(),
-                                       inst->numVecDestRegs(),
-                                       inst->numVecElemDestRegs(),
-                                       inst->numVecPredDestRegs(),
-                                       inst->numCCDestRegs())) {
+        if (!canRenameRegs(inst, tail, tid)) { /// MPINHO 17-oct-2026 ///
             DPRINTF(Rename, "Blocking due to lack of free "
                     "physical registers to rename to.\n");
             blockThisCycle = true;
@@ -697,6 +955,20 @@ DefaultRename<Impl>::renameInsts(ThreadID tid)
             break;
         }
 
+        /// MPINHO 17-oct-2026 BEGIN ///
+        // With width-aware rename, the vector results must also fit in the
+        // free register slices.
+        if (!canRenameVecSlices(inst, tail)) {
+            DPRINTF(Rename, "Blocking due to lack of free "
+                    "vector register slices to rename to.\n");
+            blockThisCycle = true;
+            insts_to_rename.push_front(inst);
+            ++renameFullVecSlicesEvents;
+
+            break;
+        }
+        /// MPINHO 17-oct-2026 END ///
+
         // Handle serializeAfter/serializeBefore instructions.
         // serializeAfter marks the next instruction as serializeBefore.
         // serializeBefore makes the instruction wait in rename until the ROB
@@ -740,7 +1012,10 @@ DefaultRename<Impl>::renameInsts(ThreadID tid)
 
         renameSrcRegs(inst, inst->threadNumber);
 
-        renameDestRegs(inst, inst->threadNumber);
+        /// MPINHO 17-oct-2026 BEGIN ///
+        if (!eliminateMove(inst, inst->threadNumber))
+            renameDestRegs(inst, inst->threadNumber);
+        /// MPINHO 17-oct-2026 END ///
 
         if (inst->isAtomic() || inst->isStore()) {
             storesInProgress[tid]++;
@@ -749,6 +1024,10 @@ DefaultRename<Impl>::renameInsts(ThreadID tid)
         }
 
         ++renamed_insts;
+        /// MPINHO 17-oct-2026 BEGIN ///
+        if (inst->fusedTail)
+            ++fused_insts;
+        /// MPINHO 17-oct-2026 END ///
         // Notify potential listeners that source and destination registers for
         // this instruction have been renamed.
         ppRename->notify(inst);
@@ -762,9 +1041,17 @@ DefaultRename<Impl>::renameInsts(ThreadID tid)
 
         // Decrement how many instructions are available.
         --insts_available;
+
+        pending_tail = std::move(tail); /// MPINHO 17-oct-2026 ///
     }
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (pending_tail)
+        ++renameSplitFusedPairs;
+    /// MPINHO 17-oct-2026 END ///
+
     instsInProgress[tid] += renamed_insts;
+    fusedInProgress[tid] += fused_insts; /// MPINHO 17-oct-2026 ///
     renameRenamedInsts += renamed_insts;
 
     // If we wrote to the time buffer, record this.
@@ -976,7 +1263,7 @@ DefaultRename<Impl>::doSquash(const InstSeqNum &squashed_seq_num, ThreadID tid)
             renameMap[tid]->setEntry(hb_it->archReg, hb_it->prevPhysReg);
 
             // Put the renamed physical register back on the free list.
-            freeList->addReg(hb_it->newPhysReg);
+            freePhysReg(hb_it->newPhysReg); /// MPINHO 17-oct-2026 ///
 
             /// MPINHO 2-april-2019 BEGIN ///
             if (hb_it->newPhysReg->isVectorPhysReg()) {
@@ -1043,7 +1330,7 @@ DefaultRename<Impl>::removeFromHistory(InstSeqNum inst_seq_num, ThreadID tid)
         // can be recognized because the new mapping is the same as
         // the old one.
         if (hb_it->newPhysReg != hb_it->prevPhysReg) {
-            freeList->addReg(hb_it->prevPhysReg);
+            freePhysReg(hb_it->prevPhysReg); /// MPINHO 17-oct-2026 ///
         }
 
         ++renameCommittedMaps;
@@ -1184,15 +1471,125 @@ DefaultRename<Impl>::renameDestRegs(const DynInstPtr &inst, ThreadID tid)
                     freeList->numFreeVecRegs());
         }
         /// MPINHO 2-april_2019 BEGIN ///
+
+        /// MPINHO 17-oct-2026 BEGIN ///
+        if (widthAwareRename && rename_result.first->isVectorPhysReg() &&
+            rename_result.first != rename_result.second) {
+            int slices = predictVecSlices(inst);
+
+            precBoard->reserveSlicesVecReg(rename_result.first, slices);
+            vecRegPC[rename_result.first->index()] = inst->instAddr();
+            renameVecSlicesPredicted.sample(slices);
+
+            DPRINTF(RegFileUsage, "Reserved %d vector slices, %d free.\n",
+                    slices, precBoard->numFreeSlices());
+        }
+        /// MPINHO 17-oct-2026 END ///
+    }
+}
+
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+bool
+DefaultRename<Impl>::eliminateMove(const DynInstPtr &inst, ThreadID tid)
+{
+    if (!moveElimination || inst->numDestRegs() != 1)
+        return false;
+
+    MoveIdiom idiom = decodeMoveIdiom(inst->staticInst);
+
+    if (idiom == MoveIdiom::None)
+        return false;
+
+    ThreadContext *tc = inst->tcBase();
+    RenameMap *map = renameMap[tid];
+    RegId flat_dest_regid = tc->flattenRegId(inst->destRegIdx(0));
+
+    if (flat_dest_regid.isZeroReg())
+        return false;
+
+    PhysRegIdPtr phys_reg = nullptr;
+
+    if (idiom == MoveIdiom::Zero) {
+        // Only the integer class has a register that always reads zero.
+        if (!flat_dest_regid.isIntReg())
+            return false;
+
+        phys_reg = map->lookup(RegId(IntRegClass, TheISA::ZeroReg));
+        assert(phys_reg->isZeroReg());
+    } else {
+        // The source is the only register read, besides the zero register.
+        for (int src_idx = 0; src_idx < inst->numSrcRegs(); src_idx++) {
+            PhysRegIdPtr src_reg = inst->renamedSrcRegIdx(src_idx);
+
+            if (src_reg->isZeroReg() || src_reg->isMiscPhysReg())
+                continue;
+
+            if (phys_reg && phys_reg != src_reg)
+                return false;
+
+            phys_reg = src_reg;
+        }
+
+        if (!phys_reg ||
+            phys_reg->classValue() != flat_dest_regid.classValue() ||
+            phys_reg->isFixedMapping()) {
+            return false;
+        }
+    }
+
+    typename RenameMap::RenameInfo rename_result =
+        map->renameAlias(flat_dest_regid, phys_reg);
+
+    inst->flattenDestReg(0, flat_dest_regid);
+
+    // A move onto a register that already holds the source changes no
+    // mapping, and, like the zero register, it is never freed through it.
+    if (rename_result.first != rename_result.second &&
+        !phys_reg->isZeroReg()) {
+        freeList->shareReg(phys_reg);
     }
+
+    // The scoreboard is left as is, the destination becomes ready when
+    // the producer of the source writes back.
+    DPRINTF(Rename, "[tid:%u]: Eliminated %s, arch reg %i (%s) mapped to "
+            "physical reg %i (%i).\n", tid,
+            idiom == MoveIdiom::Move ? "move" : "zero idiom",
+            flat_dest_regid.index(), flat_dest_regid.className(),
+            phys_reg->index(), phys_reg->flatIndex());
+
+    RenameHistory hb_entry(inst->seqNum, flat_dest_regid,
+                           rename_result.first,
+                           rename_result.second);
+
+    historyBuffer[tid].push_front(hb_entry);
+
+    inst->renameDestReg(0, rename_result.first, rename_result.second);
+    inst->moveEliminated = true;
+
+    ++renameRenamedOperands;
+
+    if (idiom == MoveIdiom::Move) {
+        ++renameMovesEliminated;
+    } else {
+        ++renameZeroIdiomsEliminated;
+    }
+
+    return true;
 }
+/// MPINHO 17-oct-2026 END ///
 
 template <class Impl>
 inline int
 DefaultRename<Impl>::calcFreeROBEntries(ThreadID tid)
 {
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // Fused tails share the entry of their head.
     int num_free = freeEntries[tid].robEntries -
-                  (instsInProgress[tid] - fromIEW->iewInfo[tid].dispatched);
+                  (instsInProgress[tid] - fromIEW->iewInfo[tid].dispatched) +
+                  (fusedInProgress[tid] -
+                   fromIEW->iewInfo[tid].dispatchedFused);
+    /// MPINHO 17-oct-2026 END ///
 
     //DPRINTF(Rename,"[tid:%i]: %i rob free\n",tid,num_free);
 
@@ -1203,8 +1600,13 @@ template <class Impl>
 inline int
 DefaultRename<Impl>::calcFreeIQEntries(ThreadID tid)
 {
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // Fused tails share the entry of their head.
     int num_free = freeEntries[tid].iqEntries -
-                  (instsInProgress[tid] - fromIEW->iewInfo[tid].dispatched);
+                  (instsInProgress[tid] - fromIEW->iewInfo[tid].dispatched) +
+                  (fusedInProgress[tid] -
+                   fromIEW->iewInfo[tid].dispatchedFused);
+    /// MPINHO 17-oct-2026 END ///
 
     //DPRINTF(Rename,"[tid:%i]: %i iq free\n",tid,num_free);
 
@@ -258,6 +258,27 @@ class UnifiedRenameMap
         }
     }
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Remap an architectural register to a physical register that is
+     * already allocated, instead of a free one. Used by move elimination,
+     * where the destination of a move shares the register of its source.
+     * The caller accounts for the extra mapping in the free list.
+     * @param arch_reg The architectural register id to remap.
+     * @param phys_reg The physical register to remap it to.
+     * @return A RenameInfo pair indicating both the new and previous
+     * physical registers.
+     */
+    RenameInfo renameAlias(const RegId& arch_reg, PhysRegIdPtr phys_reg)
+    {
+        PhysRegIdPtr prev_reg = lookup(arch_reg);
+
+        setEntry(arch_reg, phys_reg);
+
+        return RenameInfo(phys_reg, prev_reg);
+    }
+    /// MPINHO 17-oct-2026 END ///
+
     /**
      * Look up the physical register mapped to an architectural register.
      * This version takes a flattened architectural register id
@@ -67,7 +67,10 @@ class ROB
     typedef typename Impl::DynInstPtr DynInstPtr;
 
     typedef std::pair<RegIndex, PhysRegIndex> UnmapInfo;
-    typedef typename std::list<DynInstPtr>::iterator InstIt;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    typedef typename Impl::DynInstList DynInstList;
+    typedef typename DynInstList::iterator InstIt;
+    /// MPINHO 17-oct-2026 END ///
 
     /** Possible ROB statuses. */
     enum Status {
@@ -176,13 +179,15 @@ class ROB
     unsigned getThreadEntries(ThreadID tid)
     { return threadEntries[tid]; }
 
+    /// MPINHO 17-oct-2026 BEGIN ///
     /** Returns if the ROB is full. */
     bool isFull()
-    { return numInstsInROB == numEntries; }
+    { return numInstsInROB - numFusedInROB == numEntries; }
 
     /** Returns if a specific thread's partition is full. */
     bool isFull(ThreadID tid)
-    { return threadEntries[tid] == numEntries; }
+    { return threadEntries[tid] - threadFusedEntries[tid] == numEntries; }
+    /// MPINHO 17-oct-2026 END ///
 
     /** Returns if the ROB is empty. */
     bool isEmpty() const
@@ -282,8 +287,18 @@ class ROB
     /** Max Insts a Thread Can Have in the ROB */
     unsigned maxEntries[Impl::MaxThreads];
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Tails of fused macro-ops in the ROB of each thread, which share the
+     *  entry of their head.
+     */
+    unsigned threadFusedEntries[Impl::MaxThreads];
+
+    /** Tails of fused macro-ops in the ROB. */
+    unsigned numFusedInROB;
+    /// MPINHO 17-oct-2026 END ///
+
     /** ROB List of Instructions */
-    std::list<DynInstPtr> instList[Impl::MaxThreads];
+    DynInstList instList[Impl::MaxThreads]; /// MPINHO 17-oct-2026 ///
 
     /** Number of instructions that can be squashed in a single cycle. */
     unsigned squashWidth;
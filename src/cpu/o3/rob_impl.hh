@@ -105,11 +105,13 @@ ROB<Impl>::resetState()
 {
     for (ThreadID tid = 0; tid  < Impl::MaxThreads; tid++) {
         threadEntries[tid] = 0;
+        threadFusedEntries[tid] = 0; /// MPINHO 17-oct-2026 ///
         squashIt[tid] = instList[tid].end();
         squashedSeqNum[tid] = 0;
         doneSquashing[tid] = true;
     }
     numInstsInROB = 0;
+    numFusedInROB = 0; /// MPINHO 17-oct-2026 ///
 
     // Initialize the "universal" ROB head & tail point to invalid
     // pointers
@@ -211,7 +213,7 @@ ROB<Impl>::insertInst(const DynInstPtr &inst)
 
     DPRINTF(ROB, "Adding inst PC %s to the ROB.\n", inst->pcState());
 
-    assert(numInstsInROB != numEntries);
+    assert(!isFull() || inst->fusedTail); /// MPINHO 17-oct-2026 ///
 
     ThreadID tid = inst->threadNumber;
 
@@ -233,6 +235,13 @@ ROB<Impl>::insertInst(const DynInstPtr &inst)
     ++numInstsInROB;
     ++threadEntries[tid];
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (inst->fusedTail) {
+        ++numFusedInROB;
+        ++threadFusedEntries[tid];
+    }
+    /// MPINHO 17-oct-2026 END ///
+
     assert((*tail) == inst);
 
     DPRINTF(ROB, "[tid:%i] Now has %d instructions.\n", tid, threadEntries[tid]);
@@ -261,6 +270,13 @@ ROB<Impl>::retireHead(ThreadID tid)
     --numInstsInROB;
     --threadEntries[tid];
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (head_inst->fusedTail) {
+        --numFusedInROB;
+        --threadFusedEntries[tid];
+    }
+    /// MPINHO 17-oct-2026 END ///
+
     head_inst->clearInROB();
     head_inst->setCommitted();
 
@@ -308,14 +324,18 @@ template <class Impl>
 unsigned
 ROB<Impl>::numFreeEntries()
 {
-    return numEntries - numInstsInROB;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    return numEntries - numInstsInROB + numFusedInROB;
+    /// MPINHO 17-oct-2026 END ///
 }
 
 template <class Impl>
 unsigned
 ROB<Impl>::numFreeEntries(ThreadID tid)
 {
-    return maxEntries[tid] - threadEntries[tid];
+    /// MPINHO 17-oct-2026 BEGIN ///
+    return maxEntries[tid] - threadEntries[tid] + threadFusedEntries[tid];
+    /// MPINHO 17-oct-2026 END ///
 }
 
 template <class Impl>
@@ -1,6 +1,6 @@
 /// MPINHO 12-mar-2019 BEGIN ///
 #include "cpu/o3/isa_specific.hh"
-#include "cpu/o3/width_decoder_impl.hh"
+#include "cpu/width_decoder_impl.hh"
 
 // Force instantiation of InstructionQueue.
 template class WidthDecoder<O3CPUImpl>;
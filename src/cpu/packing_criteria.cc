@@ -0,0 +1,186 @@
+/// MPINHO 24-jul-2019 BEGIN ///
+
+#include "cpu/packing_criteria.hh"
+
+#include <array>
+
+bool
+simplePacking(const VecWidthCode &mask1, const VecWidthCode &mask2,
+              VecWidthCode *merged)
+{
+    // Simple: each lane must have enough space seperately.
+    assert(mask1.vectorSize() == mask2.vectorSize());
+
+    // If the width of the instructions does not match, packing fails.
+    if (mask1.elemBits() != mask2.elemBits())
+        return false;
+
+    // Evaluate lane by lane. If any lane has width overflow, packing fails.
+    int eBits = mask1.elemBits();
+    // Prepared for the case where an instruction uses only a portion of the
+    // lane. This happens in ARM Neon for example.
+    int nElem = std::min(mask1.numElem(), mask2.numElem());
+    for (int i = 0; i < nElem; i++) {
+        if (mask1.get(i) + mask2.get(i) > eBits) {
+            return false;
+        }
+    }
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (merged) {
+        // Lanes are added in place.
+        const VecWidthCode &longer =
+            mask1.numElem() >= mask2.numElem() ? mask1 : mask2;
+        *merged = longer;
+        for (int i = 0; i < nElem; i++) {
+            merged->set(i, mask1.get(i) + mask2.get(i));
+        }
+    }
+    /// MPINHO 17-oct-2026 END ///
+
+    return true;
+}
+
+bool
+optimalPacking(const VecWidthCode &mask1, const VecWidthCode &mask2,
+               VecWidthCode *merged)
+{
+    // Optimal: count number of set bits in mask.
+    assert(mask1.vectorSize() == mask2.vectorSize());
+
+    // Try to pack as much as possible, even if unfeasible.
+    int sumWidth = mask1.totalWidth() + mask2.totalWidth();
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (sumWidth > VecWidthCode::vectorSize())
+        return false;
+
+    if (merged) {
+        // Only the total width matters, so the bits are spread through the
+        // lanes of the larger mask, filling one lane at a time.
+        const VecWidthCode &larger =
+            mask1.numElem() * mask1.elemBits() >=
+            mask2.numElem() * mask2.elemBits() ? mask1 : mask2;
+        *merged = VecWidthCode(larger.numElem(), larger.elemBits(), 0);
+        int left = sumWidth;
+        for (int i = 0; i < merged->numElem() && left > 0; i++) {
+            int lane = std::min(left, merged->elemBits());
+            merged->set(i, lane);
+            left -= lane;
+        }
+        assert(left == 0);
+    }
+
+    return true;
+    /// MPINHO 17-oct-2026 END ///
+}
+
+/// MPINHO 24-jul-2019 END ///
+
+/// MPINHO 17-oct-2026 BEGIN ///
+bool
+multiElementPacking(const VecWidthCode &mask1, const VecWidthCode &mask2,
+                    VecWidthCode *merged)
+{
+    // Multi-element: elements from both masks can be placed in any lane of
+    // the same size, as long as no element is split across lanes.
+    assert(mask1.vectorSize() == mask2.vectorSize());
+
+    // Elements can only share a lane if they have the same size.
+    if (mask1.elemBits() != mask2.elemBits())
+        return false;
+
+    // A lane aligned packing is always a valid multi-element packing.
+    if (simplePacking(mask1, mask2, merged))
+        return true;
+
+    int eBits = mask1.elemBits();
+    int nLanes = std::max(mask1.numElem(), mask2.numElem());
+
+    // Quick reject: not even a perfect packing would fit.
+    if (mask1.totalWidth() + mask2.totalWidth() > nLanes * eBits)
+        return false;
+
+    // Gather the non-empty elements of both instructions.
+    std::array<int, 2 * VecWidthCode::MaxElem> elems;
+    auto elems_end = elems.begin();
+    for (int i = 0; i < mask1.numElem(); i++) {
+        if (mask1.get(i))
+            *elems_end++ = mask1.get(i);
+    }
+    for (int i = 0; i < mask2.numElem(); i++) {
+        if (mask2.get(i))
+            *elems_end++ = mask2.get(i);
+    }
+
+    // First fit decreasing: place the widest elements first, each one in the
+    // first lane with enough free space. If any element does not fit,
+    // packing fails.
+    std::sort(elems.begin(), elems_end, std::greater<int>());
+    std::array<int, VecWidthCode::MaxElem> lanes;
+    lanes.fill(0);
+    for (auto elem = elems.begin(); elem != elems_end; ++elem) {
+        int w = *elem;
+        auto lane = std::find_if(lanes.begin(), lanes.begin() + nLanes,
+                                 [w, eBits] (int used) {
+                                     return used + w <= eBits;
+                                 });
+        if (lane == lanes.begin() + nLanes)
+            return false;
+        *lane += w;
+    }
+
+    if (merged) {
+        // The resulting mask holds the lane occupancy, which is itself a
+        // valid set of elements to pack further instructions with.
+        *merged = VecWidthCode(nLanes, eBits, 0);
+        for (int i = 0; i < nLanes; i++) {
+            merged->set(i, lanes[i]);
+        }
+    }
+
+    return true;
+}
+
+bool
+disabledPacking(const VecWidthCode &mask1, const VecWidthCode &mask2,
+                VecWidthCode *merged)
+{
+    return false;
+}
+
+bool
+PackingSlot::canPack(const VecWidthCode &mask,
+                     const PackingCriteria &criteria) const
+{
+    // An empty slot takes any instruction.
+    if (empty())
+        return true;
+
+    return criteria(occupancy, mask, nullptr);
+}
+
+void
+PackingSlot::pack(const VecWidthCode &mask, const PackingCriteria &criteria)
+{
+    if (empty()) {
+        occupancy = mask;
+    } else {
+        VecWidthCode merged;
+        bool fits = criteria(occupancy, mask, &merged);
+        if (!fits) {
+            panic("Packing width mask %s into %s failed.",
+                  mask.to_string(), occupancy.to_string());
+        }
+        occupancy = merged;
+    }
+
+    ++resident;
+}
+
+void
+PackingSlot::reset()
+{
+    occupancy = VecWidthCode();
+    resident = 0;
+}
+/// MPINHO 17-oct-2026 END ///
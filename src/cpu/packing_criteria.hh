@@ -0,0 +1,71 @@
+/// MPINHO 12-mar-2019 BEGIN ///
+#ifndef __CPU_PACKING_CRITERIA_HH__
+#define __CPU_PACKING_CRITERIA_HH__
+
+#include <algorithm>
+#include <functional>
+
+#include "arch/utility.hh"
+#include "cpu/width_code.hh"
+
+/// MPINHO 17-oct-2026 BEGIN ///
+/**
+ * A packing criteria decides if the width mask of an instruction (second
+ * argument) can be packed together with the width mask already resident in
+ * a FU (first argument). If it can, and the last argument is not null, it
+ * is filled with the mask resulting from the packing.
+ */
+using PackingCriteria = std::function<bool(const VecWidthCode &,
+                                           const VecWidthCode &,
+                                           VecWidthCode *)>;
+
+bool simplePacking(const VecWidthCode &mask1, const VecWidthCode &mask2,
+                   VecWidthCode *merged = nullptr);
+bool optimalPacking(const VecWidthCode &mask1, const VecWidthCode &mask2,
+                    VecWidthCode *merged = nullptr);
+bool multiElementPacking(const VecWidthCode &mask1,
+                         const VecWidthCode &mask2,
+                         VecWidthCode *merged = nullptr);
+bool disabledPacking(const VecWidthCode &mask1, const VecWidthCode &mask2,
+                     VecWidthCode *merged = nullptr);
+
+/**
+ * Packing state of a FU for the current cycle. Keeps the number of
+ * instructions resident in the FU and the combined width mask of all of
+ * them, so that each new fuse candidate is checked against every
+ * instruction already packed, and not only against the first one.
+ */
+class PackingSlot
+{
+  private:
+    /** Combined width mask of the resident instructions. */
+    VecWidthCode occupancy;
+
+    /** Number of resident instructions. */
+    int resident;
+
+  public:
+    PackingSlot() : resident(0) {}
+
+    /** Returns true if no instruction was packed in this slot. */
+    bool empty() const { return resident == 0; }
+
+    /** Returns the number of instructions packed in this slot. */
+    int numResident() const { return resident; }
+
+    /** Returns the combined width mask of the resident instructions. */
+    const VecWidthCode &getOccupancy() const { return occupancy; }
+
+    /** Checks if a width mask can be packed in this slot. */
+    bool canPack(const VecWidthCode &mask,
+                 const PackingCriteria &criteria) const;
+
+    /** Packs a width mask in this slot (it must fit). */
+    void pack(const VecWidthCode &mask, const PackingCriteria &criteria);
+
+    /** Removes all resident instructions. */
+    void reset();
+};
+/// MPINHO 17-oct-2026 END ///
+
+#endif // __CPU_PACKING_CRITERIA_HH__
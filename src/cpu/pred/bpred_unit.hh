@@ -151,21 +151,25 @@ class BPredUnit : public SimObject
      */
     virtual void btbUpdate(ThreadID tid, Addr instPC, void * &bp_history) = 0;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
     /**
      * Looks up a given PC in the BTB to see if a matching entry exists.
      * @param inst_PC The PC to look up.
+     * @param tid The thread id.
      * @return Whether the BTB contains the given PC.
      */
-    bool BTBValid(Addr instPC)
-    { return BTB.valid(instPC, 0); }
+    bool BTBValid(Addr instPC, ThreadID tid = 0)
+    { return BTB.valid(instPC, tid); }
 
     /**
      * Looks up a given PC in the BTB to get the predicted target.
      * @param inst_PC The PC to look up.
+     * @param tid The thread id.
      * @return The address of the target of the branch.
      */
-    TheISA::PCState BTBLookup(Addr instPC)
-    { return BTB.lookup(instPC, 0); }
+    TheISA::PCState BTBLookup(Addr instPC, ThreadID tid = 0)
+    { return BTB.lookup(instPC, tid); }
+    /// MPINHO 17-oct-2026 END ///
 
     /**
      * Updates the BP with taken/not taken information.
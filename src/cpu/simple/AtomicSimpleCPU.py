@@ -61,6 +61,15 @@ class AtomicSimpleCPU(BaseSimpleCPU):
     width = Param.Int(1, "CPU width")
     simulate_data_stalls = Param.Bool(False, "Simulate dcache stall cycles")
     simulate_inst_stalls = Param.Bool(False, "Simulate icache stall cycles")
+    ### MPINHO 17-oct-2026 BEGIN ###
+    block_cache = Param.Bool(False, "Execute decoded basic blocks again "
+        "without fetching them, for fast-forwarding in SE mode (cached "
+        "instructions neither reach the icache nor stall)")
+    block_cache_size = Param.Unsigned(65536, "Maximum number of basic blocks "
+        "in the block cache of each thread")
+    block_cache_check = Param.Bool(False, "Fetch and decode the instructions "
+        "found in the block cache anyway, and panic if they differ (slow)")
+    ### MPINHO 17-oct-2026 END ###
 
     def addSimPointProbe(self, interval):
         simpoint = SimPoint()
@@ -92,6 +92,20 @@ AtomicSimpleCPU::AtomicSimpleCPU(AtomicSimpleCPUParams *p)
     data_read_req = std::make_shared<Request>();
     data_write_req = std::make_shared<Request>();
     data_amo_req = std::make_shared<Request>();
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // Only the SE address space is simple enough to flush the cache on
+    // every change, at faults and system calls
+    if (p->block_cache && FullSystem)
+        fatal("The atomic CPU block cache is only supported in SE mode.\n");
+
+    blockCaches.resize(numThreads);
+    blockCacheCheck = p->block_cache_check;
+    if (p->block_cache) {
+        for (auto &block_cache : blockCaches)
+            block_cache.init(p->block_cache_size);
+    }
+    /// MPINHO 17-oct-2026 END ///
 }
 
 
@@ -152,6 +166,8 @@ AtomicSimpleCPU::drainResume()
     DPRINTF(SimpleCPU, "Resume\n");
     verifyMemoryMode();
 
+    flushBlockCaches(); /// MPINHO 17-oct-2026 ///
+
     assert(!threadContexts.empty());
 
     _status = BaseSimpleCPU::Idle;
@@ -210,6 +226,11 @@ AtomicSimpleCPU::takeOverFrom(BaseCPU *oldCPU)
 
     // The tick event should have been descheduled by drain()
     assert(!tickEvent.scheduled());
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // Code may have been written while another CPU was running
+    flushBlockCaches();
+    /// MPINHO 17-oct-2026 END ///
 }
 
 void
@@ -304,6 +325,8 @@ AtomicSimpleCPU::AtomicCPUDPort::recvAtomicSnoop(PacketPtr pkt)
         for (auto &t_info : cpu->threadInfo) {
             TheISA::handleLockedSnoop(t_info->thread, pkt, cacheBlockMask);
         }
+
+        cpu->checkCodeWrite(pkt->getAddr()); /// MPINHO 17-oct-2026 ///
     }
 
     return 0;
@@ -331,6 +354,11 @@ AtomicSimpleCPU::AtomicCPUDPort::recvFunctionalSnoop(PacketPtr pkt)
             TheISA::handleLockedSnoop(t_info->thread, pkt, cacheBlockMask);
         }
     }
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (pkt->isWrite())
+        cpu->checkCodeWrite(pkt->getAddr());
+    /// MPINHO 17-oct-2026 END ///
 }
 
 Fault
@@ -483,6 +511,8 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
 
                     // Notify other threads on this CPU of write
                     threadSnoop(&pkt, curThread);
+
+                    checkCodeWrite(req->getPaddr()); /// MPINHO 17-oct-2026 ///
                 }
                 dcache_access = true;
                 assert(!pkt.isError());
@@ -577,6 +607,7 @@ AtomicSimpleCPU::amoMem(Addr addr, uint8_t* data, unsigned size,
             dcache_latency += TheISA::handleIprRead(thread->getTC(), &pkt);
         else {
             dcache_latency += sendPacket(dcachePort, &pkt);
+            checkCodeWrite(req->getPaddr()); /// MPINHO 17-oct-2026 ///
         }
 
         dcache_access = true;
@@ -613,6 +644,9 @@ AtomicSimpleCPU::tick()
 
     SimpleExecContext& t_info = *threadInfo[curThread];
     SimpleThread* thread = t_info.thread;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    BlockCache &block_cache = blockCaches[curThread];
+    /// MPINHO 17-oct-2026 END ///
 
     Tick latency = 0;
 
@@ -637,6 +671,26 @@ AtomicSimpleCPU::tick()
 
         bool needToFetch = !isRomMicroPC(pcState.microPC()) &&
                            !curMacroStaticInst;
+
+        /// MPINHO 17-oct-2026 BEGIN ///
+        // Instructions already decoded at this PC need no translation,
+        // fetch or decode
+        const BlockCache::Entry *checked_entry = nullptr;
+        if (needToFetch && block_cache.enabled() && t_info.fetchOffset == 0) {
+            const BlockCache::Entry *entry = block_cache.lookup(pcState);
+            if (entry && blockCacheCheck) {
+                checked_entry = entry;
+                blockCacheHits++;
+            } else if (entry) {
+                predecodedInst = entry->inst;
+                predecodedPC = entry->pcAfter;
+                needToFetch = false;
+                blockCacheHits++;
+            } else {
+                blockCacheMisses++;
+            }
+        }
+        /// MPINHO 17-oct-2026 END ///
         if (needToFetch) {
             ifetch_req->taskId(taskId());
             setupFetchRequest(ifetch_req);
@@ -672,6 +726,17 @@ AtomicSimpleCPU::tick()
 
             preExecute();
 
+            /// MPINHO 17-oct-2026 BEGIN ///
+            if (checked_entry) {
+                checkBlockCacheEntry(*checked_entry);
+            } else if (needToFetch && block_cache.enabled() &&
+                       curStaticInst && !t_info.stayAtPC) {
+                block_cache.record(pcState, thread->pcState(),
+                    curMacroStaticInst ? curMacroStaticInst : curStaticInst,
+                    ifetch_req->getPaddr());
+            }
+            /// MPINHO 17-oct-2026 END ///
+
             Tick stall_ticks = 0;
             if (curStaticInst) {
                 fault = curStaticInst->execute(&t_info, traceData);
@@ -717,6 +782,15 @@ AtomicSimpleCPU::tick()
             }
 
         }
+
+        /// MPINHO 17-oct-2026 BEGIN ///
+        // Faults and system calls can change the address space
+        if (block_cache.enabled() && (fault != NoFault ||
+            (curStaticInst && curStaticInst->isSyscall()))) {
+            flushBlockCaches();
+        }
+        /// MPINHO 17-oct-2026 END ///
+
         if (fault != NoFault || !t_info.stayAtPC)
             advancePC(fault);
     }
@@ -732,6 +806,60 @@ AtomicSimpleCPU::tick()
         reschedule(tickEvent, curTick() + latency, true);
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+void
+AtomicSimpleCPU::flushBlockCaches()
+{
+    for (auto &block_cache : blockCaches) {
+        if (block_cache.enabled()) {
+            block_cache.flush();
+            blockCacheFlushes++;
+        }
+    }
+}
+
+void
+AtomicSimpleCPU::checkBlockCacheEntry(const BlockCache::Entry &entry)
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    TheISA::PCState pc_after = t_info.thread->pcState();
+    const StaticInstPtr &decoded =
+        curMacroStaticInst ? curMacroStaticInst : curStaticInst;
+
+    if (t_info.stayAtPC || decoded != entry.inst ||
+        pc_after != entry.pcAfter) {
+        panic("Block cache mismatch at %s: cached \"%s\" (next %s), "
+              "decoded \"%s\" (next %s)", entry.pcBefore,
+              entry.inst->disassemble(entry.pcBefore.instAddr()),
+              entry.pcAfter,
+              decoded ? decoded->disassemble(entry.pcBefore.instAddr()) :
+                        "none",
+              pc_after);
+    }
+}
+
+void
+AtomicSimpleCPU::regStats()
+{
+    BaseSimpleCPU::regStats();
+
+    blockCacheHits
+        .name(name() + ".blockCacheHits")
+        .desc("Number of instructions taken from the block cache")
+        ;
+
+    blockCacheMisses
+        .name(name() + ".blockCacheMisses")
+        .desc("Number of block cache lookups that had to fetch and decode")
+        ;
+
+    blockCacheFlushes
+        .name(name() + ".blockCacheFlushes")
+        .desc("Number of times a thread's block cache was flushed")
+        ;
+}
+/// MPINHO 17-oct-2026 END ///
+
 void
 AtomicSimpleCPU::regProbePoints()
 {
@@ -44,6 +44,7 @@
 #define __CPU_SIMPLE_ATOMIC_HH__
 
 #include "cpu/simple/base.hh"
+#include "cpu/simple/block_cache.hh" /// MPINHO 17-oct-2026 ///
 #include "cpu/simple/exec_context.hh"
 #include "mem/request.hh"
 #include "params/AtomicSimpleCPU.hh"
@@ -171,6 +172,41 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     /** Probe Points. */
     ProbePointArg<std::pair<SimpleThread*, const StaticInstPtr>> *ppCommit;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Decoded basic blocks of each thread, if enabled */
+    std::vector<BlockCache> blockCaches;
+
+    /** Fetch and decode cached instructions too, to check the cache */
+    bool blockCacheCheck;
+
+    /** Instructions taken from the block cache */
+    Stats::Scalar blockCacheHits;
+    /** Instructions fetched and decoded while the block cache is enabled */
+    Stats::Scalar blockCacheMisses;
+    /** Flushes of the block caches */
+    Stats::Scalar blockCacheFlushes;
+
+    /** Drops the cached blocks of every thread */
+    void flushBlockCaches();
+
+    /** Panics if the instruction just fetched and decoded is not the
+     *  one the block cache had for it */
+    void checkBlockCacheEntry(const BlockCache::Entry &entry);
+
+    /** Flushes the block caches if paddr is in a page holding cached
+     *  instructions, to catch self-modifying code */
+    void
+    checkCodeWrite(Addr paddr)
+    {
+        for (const auto &block_cache : blockCaches) {
+            if (block_cache.holdsCode(paddr)) {
+                flushBlockCaches();
+                return;
+            }
+        }
+    }
+    /// MPINHO 17-oct-2026 END ///
+
   protected:
 
     /** Return a reference to the data port. */
@@ -190,6 +226,8 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     void switchOut() override;
     void takeOverFrom(BaseCPU *oldCPU) override;
 
+    void regStats() override; /// MPINHO 17-oct-2026 ///
+
     void verifyMemoryMode() const override;
 
     void activateContext(ThreadID thread_num) override;
@@ -518,14 +518,23 @@ BaseSimpleCPU::preExecute()
         //Predecode, ie bundle up an ExtMachInst
         //If more fetch data is needed, pass it in.
         Addr fetchPC = (pcState.instAddr() & PCMask) + t_info.fetchOffset;
-        //if (decoder->needMoreBytes())
-            decoder->moreBytes(pcState, fetchPC, inst);
-        //else
-        //    decoder->process();
-
-        //Decode an instruction if one is ready. Otherwise, we'll have to
-        //fetch beyond the MachInst at the current pc.
-        instPtr = decoder->decode(pcState);
+        /// MPINHO 17-oct-2026 BEGIN ///
+        if (predecodedInst) {
+            //Nothing was fetched, the CPU model already has the instruction
+            instPtr = predecodedInst;
+            pcState = predecodedPC;
+            predecodedInst = NULL;
+        } else {
+            //if (decoder->needMoreBytes())
+                decoder->moreBytes(pcState, fetchPC, inst);
+            //else
+            //    decoder->process();
+
+            //Decode an instruction if one is ready. Otherwise, we'll have
+            //to fetch beyond the MachInst at the current pc.
+            instPtr = decoder->decode(pcState);
+        }
+        /// MPINHO 17-oct-2026 END ///
         if (instPtr) {
             t_info.stayAtPC = false;
             thread->pcState(pcState);
@@ -107,6 +107,14 @@ class BaseSimpleCPU : public BaseCPU
     StaticInstPtr curStaticInst;
     StaticInstPtr curMacroStaticInst;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Instruction at the PC, already decoded by the CPU model, and the PC
+     *  state the decoder left.  preExecute takes it, if set, instead of
+     *  decoding the fetched bytes */
+    StaticInstPtr predecodedInst;
+    TheISA::PCState predecodedPC;
+    /// MPINHO 17-oct-2026 END ///
+
   protected:
     enum Status {
         Idle,
@@ -0,0 +1,137 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+
+#include "cpu/simple/block_cache.hh"
+
+BlockCache::BlockCache()
+    : maxBlocks(0),
+      curBlock(nullptr),
+      curIndex(0),
+      building(nullptr)
+{}
+
+void
+BlockCache::init(unsigned max_blocks)
+{
+    maxBlocks = max_blocks;
+    flush();
+}
+
+void
+BlockCache::flush()
+{
+    blocks.clear();
+    codePages.clear();
+    curBlock = nullptr;
+    curIndex = 0;
+    building = nullptr;
+}
+
+void
+BlockCache::endBuilding()
+{
+    curBlock = building;
+    curIndex = building->entries.size();
+    building = nullptr;
+}
+
+const BlockCache::Entry *
+BlockCache::enter(Block &block, const TheISA::PCState &pc)
+{
+    curBlock = nullptr;
+
+    if (block.entries.empty()) {
+        // Started, but no instruction was recorded yet.
+        building = &block;
+        return nullptr;
+    }
+
+    // The same address decoded in another mode is not cached.
+    if (block.entries[0].pcBefore != pc)
+        return nullptr;
+
+    curBlock = &block;
+    curIndex = 1;
+    return &block.entries[0];
+}
+
+const BlockCache::Entry *
+BlockCache::lookup(const TheISA::PCState &pc)
+{
+    Addr addr = pc.instAddr();
+
+    if (building) {
+        const std::vector<Entry> &entries = building->entries;
+
+        if (entries.empty()) {
+            if (addr == building->startPC)
+                return nullptr;
+        } else if (addr == entries.back().pcAfter.npc() &&
+                   pageOf(addr) == pageOf(building->startPC) &&
+                   !blocks.count(addr)) {
+            return nullptr;
+        }
+
+        // Control left the straight-line code, or went into the next page
+        // or into a block already cached.
+        endBuilding();
+    }
+
+    Block *prev = nullptr;
+
+    if (curBlock) {
+        if (curIndex < curBlock->entries.size()) {
+            const Entry &entry = curBlock->entries[curIndex];
+            if (entry.pcBefore == pc) {
+                ++curIndex;
+                return &entry;
+            }
+        } else {
+            Block *next = curBlock->successor;
+            if (next && !next->entries.empty() &&
+                next->entries[0].pcBefore == pc) {
+                curBlock = next;
+                curIndex = 1;
+                return &next->entries[0];
+            }
+            prev = curBlock;
+        }
+    }
+
+    auto it = blocks.find(addr);
+    if (it == blocks.end()) {
+        if (blocks.size() >= maxBlocks) {
+            flush();
+            prev = nullptr;
+        }
+        it = blocks.emplace(addr, Block(addr)).first;
+    }
+
+    if (prev)
+        prev->successor = &it->second;
+
+    return enter(it->second, pc);
+}
+
+void
+BlockCache::record(const TheISA::PCState &pc_before,
+                   const TheISA::PCState &pc_after,
+                   const StaticInstPtr &inst, Addr paddr)
+{
+    if (!building)
+        return;
+
+    // An instruction across two pages would only be invalidated by writes
+    // to the page it was fetched from last.
+    if (pageOf(pc_before.instAddr()) != pageOf(pc_after.npc() - 1)) {
+        endBuilding();
+        return;
+    }
+
+    building->entries.push_back({pc_before, pc_after, inst});
+    codePages.insert(pageOf(paddr));
+
+    if (inst->isControl())
+        endBuilding();
+}
+
+/// MPINHO 17-oct-2026 END ///
@@ -0,0 +1,119 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+#ifndef __CPU_SIMPLE_BLOCK_CACHE_HH__
+#define __CPU_SIMPLE_BLOCK_CACHE_HH__
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "arch/isa_traits.hh"
+#include "arch/types.hh"
+#include "base/types.hh"
+#include "cpu/static_inst.hh"
+
+/**
+ * Cache of decoded basic blocks, used by AtomicSimpleCPU to skip the fetch
+ * and decode of instructions it has already executed.
+ *
+ * A block holds the instructions decoded from straight-line code starting
+ * at one PC, in program order, with the PC state before and after each of
+ * them was decoded. An instruction is only taken from the cache when the
+ * PC state of the thread is the one it was decoded with, so that decoder
+ * modes held in the PC state (e.g. Thumb or an IT block) are never mixed
+ * up. Blocks end at control instructions and page boundaries, and each one
+ * is chained to the block executed after it, so that the map of blocks is
+ * only searched when control flow goes somewhere new.
+ *
+ * Taking an instruction from the cache skips its translation, its fetch
+ * and the decoder. The owner must flush the cache whenever that could give
+ * a different instruction: on writes to a page holding cached code and on
+ * any change of the address space.
+ */
+class BlockCache
+{
+  public:
+    /** A decoded instruction. */
+    struct Entry
+    {
+        /** PC state the instruction was decoded with. */
+        TheISA::PCState pcBefore;
+        /** PC state left by the decoder. */
+        TheISA::PCState pcAfter;
+        /** The instruction, a macro-op if it was decoded into micro-ops. */
+        StaticInstPtr inst;
+    };
+
+  private:
+    struct Block
+    {
+        /** Address of the first instruction. */
+        Addr startPC;
+        std::vector<Entry> entries;
+        /** Block executed after this one the last time it ended. */
+        Block *successor;
+
+        Block(Addr start_pc) : startPC(start_pc), successor(nullptr) {}
+    };
+
+    /** Blocks by the address of their first instruction. */
+    std::unordered_map<Addr, Block> blocks;
+
+    /** Physical pages the cached instructions were fetched from. */
+    std::unordered_set<Addr> codePages;
+
+    /** Maximum number of blocks, the cache is flushed when it is full. */
+    unsigned maxBlocks;
+
+    /** Block being executed from the cache and its next entry. */
+    Block *curBlock;
+    size_t curIndex;
+
+    /** Block that decoded instructions are added to, if any. */
+    Block *building;
+
+    /** Ends the block being built, the next block becomes its successor. */
+    void endBuilding();
+
+    static Addr
+    pageOf(Addr addr)
+    {
+        return addr & ~(TheISA::PageBytes - 1);
+    }
+
+    /** Starts executing a cached block, or building it if empty. */
+    const Entry *enter(Block &block, const TheISA::PCState &pc);
+
+  public:
+    BlockCache();
+
+    /** A cache of max_blocks blocks, 0 disables it. */
+    void init(unsigned max_blocks);
+
+    bool enabled() const { return maxBlocks != 0; }
+
+    /**
+     * Finds the instruction to execute with PC state pc.
+     *
+     * @return The cached instruction, or nullptr if it must be fetched and
+     * decoded, in which case it should then be passed to record().
+     */
+    const Entry *lookup(const TheISA::PCState &pc);
+
+    /** Adds an instruction fetched from paddr to the block being built. */
+    void record(const TheISA::PCState &pc_before,
+                const TheISA::PCState &pc_after, const StaticInstPtr &inst,
+                Addr paddr);
+
+    /** Do cached instructions come from the page of paddr? */
+    bool
+    holdsCode(Addr paddr) const
+    {
+        return !codePages.empty() && codePages.count(pageOf(paddr));
+    }
+
+    /** Drops all blocks. */
+    void flush();
+};
+
+#endif // __CPU_SIMPLE_BLOCK_CACHE_HH__
+/// MPINHO 17-oct-2026 END ///
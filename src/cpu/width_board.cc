@@ -0,0 +1,26 @@
+
+#include "cpu/width_board.hh"
+
+#include <algorithm>
+
+#include "config/the_isa.hh"
+
+PrecisionBoard::PrecisionBoard(const std::string &_my_name,
+                               unsigned _numPhysicalVecRegs)
+    : _name(_my_name),
+      vecRegBoard(_numPhysicalVecRegs),
+      numPhysicalVecRegs(_numPhysicalVecRegs),
+      sliceCapacity(0),
+      slicesUsed(0)
+{
+}
+
+int
+PrecisionBoard::numSlices(const VecWidthCode &view)
+{
+    int sliceBits = view.elemBits() / NumSlices;
+    int slices = (view.maxWidth() + sliceBits - 1) / sliceBits;
+
+    // Even an all zeros value takes one slice.
+    return std::max(slices, 1);
+}
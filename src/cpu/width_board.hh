@@ -0,0 +1,291 @@
+#ifndef __CPU_WIDTH_BOARD_HH__
+#define __CPU_WIDTH_BOARD_HH__
+
+#include <array>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "base/trace.hh"
+#include "config/the_isa.hh"
+#include "cpu/reg_class.hh"
+#include "cpu/width_code.hh"
+#include "debug/WidthBoard.hh"
+
+/**
+ * Implements a auxiliary structure to store the width of the
+ * physical registers of a certain class. The register indexing is
+ * relative, as the register class is implied by the instance.
+ *
+ * The width of a vector register is kept for the element sizes it is
+ * read as (8, 16, 32 and 64-bit lanes), so a consumer can get the mask of
+ * its operand without reading the register value again. The entry is
+ * filled with the element size of the producer when the register is
+ * written back, the other element sizes are added as consumers read them,
+ * and it is cleared when the register returns to the free list.
+ *
+ * For register file banking, each vector register is also split in
+ * NumSlices slices of equal size, and the board records how many of those
+ * (per element) the value written in the register needs.
+ *
+ * With width-aware rename, the board also keeps the slices reserved for
+ * each register out of a shared pool of slices. Rename reserves the
+ * predicted slices and, if the value written back needs more, the
+ * reservation grows at writeback.
+ */
+class PrecisionBoard
+{
+  public:
+    /** Number of element sizes a vector register can be read as. */
+    static const int NumViews = 4;
+
+    /** Number of slices a vector register is split in, for banking. */
+    static const int NumSlices = 4;
+
+    /** Width masks of a vector register, indexed by element size. */
+    typedef std::array<VecWidthCode, NumViews> VecRegViews;
+
+  private:
+    /** Width entry of a physical vector register. */
+    struct VecRegWidth
+    {
+        /** Whether the register has width information. */
+        bool valid;
+        /** Number of slices needed by the register value. */
+        uint8_t slices;
+        /** Number of slices predicted at rename. */
+        uint8_t predicted;
+        /** Number of slices reserved in the slice pool. */
+        uint8_t reserved;
+        /** Element sizes with a width mask, one bit per size. */
+        uint8_t viewMask;
+        /** Width masks of the register, by element size. */
+        VecRegViews views;
+
+        VecRegWidth()
+            : valid(false), slices(NumSlices), predicted(0), reserved(0),
+              viewMask(0)
+        {}
+    };
+
+    /** The object name, for DPRINTF. */
+    const std::string _name;
+
+    /** Vector registers. */
+    std::vector<VecRegWidth> vecRegBoard;
+
+    /**
+     * Number of physical vector registers
+     */
+    unsigned M5_CLASS_VAR_USED numPhysicalVecRegs;
+
+    /** Number of slices in the slice pool. */
+    unsigned sliceCapacity;
+
+    /** Number of slices reserved from the slice pool. */
+    unsigned slicesUsed;
+
+  public:
+    PrecisionBoard(const std::string &_my_name,
+                   unsigned _numPhysicalVecRegs);
+
+    ~PrecisionBoard() {}
+
+    std::string name() const { return _name; };
+
+    /** Returns the number of physical vector registers. */
+    unsigned numVecRegs() const { return numPhysicalVecRegs; }
+
+    /** Sets the number of slices in the slice pool. */
+    void setSliceCapacity(unsigned capacity) { sliceCapacity = capacity; }
+
+    /** Returns the number of slices in the slice pool. */
+    unsigned getSliceCapacity() const { return sliceCapacity; }
+
+    /** Returns the number of slices reserved. */
+    unsigned numUsedSlices() const { return slicesUsed; }
+
+    /** Returns the number of slices still free in the slice pool. */
+    unsigned numFreeSlices() const
+    {
+        return slicesUsed < sliceCapacity ? sliceCapacity - slicesUsed : 0;
+    }
+
+    /** Returns the number of slices needed by a width mask. */
+    static int numSlices(const VecWidthCode &view);
+
+    /** Checks if the vector register has width information. */
+    bool hasWidthVecReg(PhysRegIdPtr phys_reg) const
+    {
+        assert(phys_reg->isVectorPhysReg());
+        assert(phys_reg->index() < numPhysicalVecRegs);
+
+        return vecRegBoard[phys_reg->index()].valid;
+    }
+
+    /**
+     * Checks if the vector register has a width mask for lanes of
+     * 8 << size bits.
+     */
+    bool hasWidthVecReg(PhysRegIdPtr phys_reg, uint8_t size) const
+    {
+        assert(phys_reg->isVectorPhysReg());
+        assert(phys_reg->index() < numPhysicalVecRegs);
+        assert(size < NumViews);
+
+        const VecRegWidth &entry = vecRegBoard[phys_reg->index()];
+
+        return entry.valid && (entry.viewMask & (1 << size));
+    }
+
+    /**
+     * Returns the width mask of a vector register, read with lanes of
+     * 8 << size bits.
+     */
+    const VecWidthCode &getWidthVecReg(PhysRegIdPtr phys_reg,
+                                       uint8_t size) const
+    {
+        assert(phys_reg->isVectorPhysReg());
+        assert(phys_reg->index() < numPhysicalVecRegs);
+        assert(size < NumViews);
+
+        DPRINTF(WidthBoard, "Getting width of reg %i (%s)\n",
+                phys_reg->index(), phys_reg->className());
+
+        const VecRegWidth &entry = vecRegBoard[phys_reg->index()];
+
+        if (!entry.valid || !(entry.viewMask & (1 << size))) {
+            panic("Reg %i (%s) had no assigned width for size %d\n",
+                  phys_reg->index(), phys_reg->className(), size);
+        }
+
+        return entry.views[size];
+    }
+
+    /** Returns the number of slices needed by a vector register. */
+    int getSlicesVecReg(PhysRegIdPtr phys_reg) const
+    {
+        assert(phys_reg->isVectorPhysReg());
+        assert(phys_reg->index() < numPhysicalVecRegs);
+
+        const VecRegWidth &entry = vecRegBoard[phys_reg->index()];
+
+        // Without information, assume the whole register is used.
+        return entry.valid ? entry.slices : NumSlices;
+    }
+
+    /**
+     * Sets the width of a vector register written back, from its mask with
+     * the element size of the producer, which gives the number of slices.
+     */
+    void setWidthVecReg(PhysRegIdPtr phys_reg, const VecWidthCode &view,
+                        uint8_t size)
+    {
+        assert(phys_reg->isVectorPhysReg());
+        assert(phys_reg->index() < numPhysicalVecRegs);
+        assert(size < NumViews);
+
+        DPRINTF(WidthBoard, "Setting width of reg %i (%s)\n",
+                phys_reg->index(), phys_reg->className());
+
+        VecRegWidth &entry = vecRegBoard[phys_reg->index()];
+
+        entry.valid = true;
+        entry.slices = numSlices(view);
+        entry.viewMask = 1 << size;
+        entry.views[size] = view;
+
+        // The value does not fit the reserved slices, take the missing
+        // ones from the pool.
+        if (entry.reserved && entry.slices > entry.reserved) {
+            DPRINTF(WidthBoard, "Reg %i (%s) needs %d slices, %d reserved\n",
+                    phys_reg->index(), phys_reg->className(),
+                    entry.slices, entry.reserved);
+
+            slicesUsed += entry.slices - entry.reserved;
+            entry.reserved = entry.slices;
+        }
+    }
+
+    /**
+     * Adds the width mask of a vector register read with lanes of
+     * 8 << size bits, or sets its width if it has none yet.
+     */
+    void addWidthVecReg(PhysRegIdPtr phys_reg, const VecWidthCode &view,
+                        uint8_t size)
+    {
+        assert(phys_reg->isVectorPhysReg());
+        assert(phys_reg->index() < numPhysicalVecRegs);
+        assert(size < NumViews);
+
+        VecRegWidth &entry = vecRegBoard[phys_reg->index()];
+
+        if (!entry.valid) {
+            setWidthVecReg(phys_reg, view, size);
+            return;
+        }
+
+        entry.viewMask |= 1 << size;
+        entry.views[size] = view;
+    }
+
+    void clearWidthVecReg(PhysRegIdPtr phys_reg)
+    {
+        assert(phys_reg->isVectorPhysReg());
+        assert(phys_reg->index() < numPhysicalVecRegs);
+
+        DPRINTF(WidthBoard, "Clearing width of reg %i (%s)\n",
+                phys_reg->index(), phys_reg->className());
+
+        vecRegBoard[phys_reg->index()].valid = false;
+        vecRegBoard[phys_reg->index()].viewMask = 0;
+    }
+
+    /** Reserves slices from the pool for a renamed vector register. */
+    void reserveSlicesVecReg(PhysRegIdPtr phys_reg, int slices)
+    {
+        assert(phys_reg->isVectorPhysReg());
+        assert(phys_reg->index() < numPhysicalVecRegs);
+        assert(slices > 0 && slices <= NumSlices);
+
+        VecRegWidth &entry = vecRegBoard[phys_reg->index()];
+
+        assert(!entry.reserved);
+
+        DPRINTF(WidthBoard, "Reserving %d slices for reg %i (%s)\n",
+                slices, phys_reg->index(), phys_reg->className());
+
+        entry.predicted = slices;
+        entry.reserved = slices;
+        slicesUsed += slices;
+    }
+
+    /** Returns the number of slices predicted for a vector register. */
+    int getPredictedSlicesVecReg(PhysRegIdPtr phys_reg) const
+    {
+        assert(phys_reg->isVectorPhysReg());
+        assert(phys_reg->index() < numPhysicalVecRegs);
+
+        return vecRegBoard[phys_reg->index()].predicted;
+    }
+
+    /** Returns the slices of a vector register to the pool. */
+    void releaseSlicesVecReg(PhysRegIdPtr phys_reg)
+    {
+        assert(phys_reg->isVectorPhysReg());
+        assert(phys_reg->index() < numPhysicalVecRegs);
+
+        VecRegWidth &entry = vecRegBoard[phys_reg->index()];
+
+        DPRINTF(WidthBoard, "Releasing %d slices of reg %i (%s)\n",
+                entry.reserved, phys_reg->index(), phys_reg->className());
+
+        assert(slicesUsed >= entry.reserved);
+        slicesUsed -= entry.reserved;
+        entry.predicted = 0;
+        entry.reserved = 0;
+    }
+
+};
+
+#endif // __CPU_WIDTH_BOARD_HH__
@@ -3,11 +3,15 @@
 #include <algorithm>
 #include <numeric>
 
-#include "cpu/o3/width_code.hh"
+#include "cpu/width_code.hh"
 #include "config/the_isa.hh"
 
 VecWidthCode::VecWidthCode()
-{}
+    : eBits(0),
+      nElem(0)
+{
+    code.fill(0);
+}
 
 VecWidthCode::VecWidthCode(int _nElem, int _eBits)
     : eBits(_eBits),
@@ -17,8 +21,12 @@ VecWidthCode::VecWidthCode(int _nElem, int _eBits)
         panic("Vector code is too large (%dx%d-bits).",
               _nElem, _eBits);
     }
+    if (_nElem > MaxElem || _eBits > MaxElemBits) {
+        panic("Vector code is not supported (%dx%d-bits).",
+              _nElem, _eBits);
+    }
 
-    code = std::vector<int>(nElem);
+    code.fill(0);
 }
 
 VecWidthCode::VecWidthCode(int _nElem, int _eBits, int val)
@@ -29,47 +37,25 @@ VecWidthCode::VecWidthCode(int _nElem, int _eBits, int val)
               val, _eBits);
     }
 
-    std::fill(code.begin(), code.end(), val);
-}
-
-int
-VecWidthCode::totalWidth()
-{
-    // TODO: use std::accumullate().
-    int ret = 0;
-    for (int i = 0; i < nElem; i++) {
-        ret += code[i];
-    }
-    return ret;
-}
-
-int
-VecWidthCode::maxWidth()
-{
-    // TODO: use std::max_element().
-    int ret = 0;
-    for (int i = 0; i < nElem; i++) {
-        if (code[i] > ret)
-            ret = code[i];
-    }
-    return ret;
+    std::fill(code.begin(), code.begin() + nElem, val);
 }
 
 std::string
-VecWidthCode::to_string()
+VecWidthCode::to_string() const
 {
     std::stringstream ss;
 
     for (int i = 0; i < nElem; i++) {
-        ss << code[i] << ":";
+        ss << static_cast<int>(code[i]) << ":";
     }
-    ss << ":" << nElem << "x" << eBits << "-bit";
+    ss << ":" << static_cast<int>(nElem) << "x"
+       << static_cast<int>(eBits) << "-bit";
 
     return ss.str();
 }
 
 VecWidthCode
-VecWidthCode::generate1OpPairLong()
+VecWidthCode::generate1OpPairLong() const
 {
     assert((nElem & 1) == 0);
 
@@ -83,26 +69,27 @@ VecWidthCode::generate1OpPairLong()
 }
 
 VecWidthCode
-VecWidthCode::generate1OpAcross()
+VecWidthCode::generate1OpAcross() const
 {
     return VecWidthCode(nElem, eBits, maxWidth());
 }
 
 VecWidthCode
-VecWidthCode::combine2OpRegl(const VecWidthCode &b)
+VecWidthCode::combine2OpRegl(const VecWidthCode &b) const
 {
     assert(match(b));
 
     VecWidthCode res(nElem, eBits);
 
-    for (int i = 0; i < nElem; i++) {
+    // Unused lanes are zero in both codes, so all lanes can be combined.
+    for (int i = 0; i < MaxElem; i++) {
         res.code[i] = std::max(code[i], b.code[i]);
     }
     return res;
 }
 
 VecWidthCode
-VecWidthCode::combine2OpPair(const VecWidthCode &b)
+VecWidthCode::combine2OpPair(const VecWidthCode &b) const
 {
     assert(match(b));
 
@@ -0,0 +1,104 @@
+/// MPINHO 21-mar-2019 BEGIN ///
+#ifndef __CPU_WIDTH_CODE_HH__
+#define __CPU_WIDTH_CODE_HH__
+
+#include <array>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "arch/utility.hh"
+#include "cpu/func_unit_width.hh"
+
+/*
+ * Class for vector width information encoding.
+ *
+ * Used to verify if instructions can be merged and register usage.
+ *
+ * The code is kept in a fixed size array, with one byte per lane and unused
+ * lanes set to zero, so the class can be copied without allocations and the
+ * lane operations are simple loops over all lanes that the compiler can
+ * vectorize.
+ */
+class VecWidthCode
+{
+    public:
+        /** Maximum number of lanes (16x8-bit). */
+        static const int MaxElem = 16;
+        /** Maximum lane size, in bits. */
+        static const int MaxElemBits = 64;
+
+    private:
+        uint8_t eBits;
+        uint8_t nElem;
+        std::array<uint8_t, MaxElem> code;
+
+    public:
+        VecWidthCode();
+
+        VecWidthCode(int _nElem, int _eBits);
+
+        VecWidthCode(int _nElem, int _eBits, int val);
+
+        static int vectorSize() { return static_cast<int>(ScalarSizeBits); }
+        int elemBits() const { return eBits; }
+        int numElem() const { return nElem; }
+
+        void
+        set(int pos, int val) {
+            if (pos < 0 || pos >= nElem) {
+                panic("Invalid code position: %d", pos);
+            }
+            if (val < 0 || val > eBits) {
+                panic("Invalid code val: %d (size: %d, pos: %d).",
+                    val, eBits, pos);
+            }
+
+            code[pos] = val;
+        }
+
+        int
+        get(int pos) const {
+            if (pos < 0 || pos >= nElem) {
+                panic("Invalid code position: %d", pos);
+            }
+
+            return (code[pos]);
+        }
+
+        bool
+        match(const VecWidthCode& b) const {
+            return eBits == b.eBits && nElem == b.nElem;
+        }
+
+        /** Sum of the widths of all lanes. */
+        int
+        totalWidth() const {
+            int ret = 0;
+            for (int i = 0; i < MaxElem; i++) {
+                ret += code[i];
+            }
+            return ret;
+        }
+
+        /** Maximum width of all lanes. */
+        int
+        maxWidth() const {
+            uint8_t ret = 0;
+            for (int i = 0; i < MaxElem; i++) {
+                ret = std::max(ret, code[i]);
+            }
+            return ret;
+        }
+
+        std::string to_string() const;
+
+        VecWidthCode generate1OpPairLong() const;
+        VecWidthCode generate1OpAcross() const;
+        VecWidthCode combine2OpRegl(const VecWidthCode& b) const;
+        VecWidthCode combine2OpPair(const VecWidthCode& b) const;
+};
+#endif // __CPU_WIDTH_CODE_HH__
+
+/// MPINHO 23-mar-2019 END ///
@@ -1,6 +1,6 @@
 /// MPINHO 12-mar-2019 BEGIN ///
-#ifndef __CPU_O3_WIDTH_DECODER_HH__
-#define __CPU_O3_WIDTH_DECODER_HH__
+#ifndef __CPU_WIDTH_DECODER_HH__
+#define __CPU_WIDTH_DECODER_HH__
 
 #include <algorithm>
 #include <array>
@@ -11,24 +11,22 @@
 #include <vector>
 
 #include "arch/types.hh"
+#include "base/resolution.hh" /// MPINHO 17-oct-2026 ///
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/func_unit_width.hh"
-#include "cpu/o3/packing_criteria.hh"
-#include "cpu/o3/width_code.hh"
-#include "cpu/o3/width_info.hh"
 #include "cpu/op_class.hh"
+#include "cpu/packing_criteria.hh"
+#include "cpu/width_board.hh"
+#include "cpu/width_code.hh"
+#include "cpu/width_info.hh"
+#include "cpu/width_predictor.hh" /// MPINHO 17-oct-2026 ///
 #include "debug/WidthDecoder.hh"
 #include "enums/VecElemSize.hh"
 #include "enums/WidthClass.hh"
 #include "enums/WidthDefinition.hh"
 #include "enums/WidthPackingPolicy.hh"
 
-struct DerivO3CPUParams;
-
-template <class Impl>
-class InstructionQueue;
-
 /**
  * cpu structure for evaluate that evaluates the width required by an
  * operation.
@@ -58,17 +56,24 @@ class WidthDecoder
     /** Empty constructor. */
     WidthDecoder();
 
-    /** Constructs a width decoder with given parameters. */
-    WidthDecoder(O3CPU *cpu_ptr, DerivO3CPUParams *params);
-
     /** Destructs the width decoder. */
     ~WidthDecoder();
 
     /** Returns the name of the width decoder. */
     std::string name() const { return _name; };
 
-    /** Initializes with decoder with parameters. */
-    void init(DerivO3CPUParams *params);
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Initializes the decoder with the width parameters of a CPU. The
+     * width predictor is left disabled.
+     */
+    void init(const std::string &base_name, WidthDefinition width_def,
+              unsigned block_size, WidthPackingPolicy packing_policy);
+
+    /** Enables the width predictor used at dispatch. */
+    void initPredictor(unsigned size, unsigned counter_bits,
+                       unsigned threshold);
+    /// MPINHO 17-oct-2026 END ///
 
     /** Registers statistics. */
     void regStats();
@@ -76,8 +81,16 @@ class WidthDecoder
     /** Sets the pointer to the CPU. */
     void setCPU(O3CPU *cpu_ptr);
 
-    /** Sets the pointer to the IQ. */
-    void setIQ(InstructionQueue<Impl> *iq_ptr);
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Sets the pointer to the precision board. */
+    void setPrecisionBoard(PrecisionBoard *pb_ptr);
+
+    /**
+     * Records the width of the vector destination registers of an
+     * instruction that is writing back in the precision board.
+     */
+    void writebackWidth(const DynInstPtr &inst);
+    /// MPINHO 17-oct-2026 END ///
 
     /** Return width mask of a vector instruction. */
     VecWidthCode vecInstWidthMask(const DynInstPtr &inst);
@@ -110,6 +123,21 @@ class WidthDecoder
     /** Returns the width information for a given instruction. */
     void addWidthInfo(const DynInstPtr &inst);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Tags a fuseable instruction with its predicted width, when it enters
+     * the IQ and its operands may not be ready yet.
+     */
+    void predictWidth(const DynInstPtr &inst);
+
+    /**
+     * Returns true if an instruction that is ready is expected to fuse with
+     * one that is not, given the predicted width of the latter.
+     */
+    bool canFusePredicted(const DynInstPtr &inst,
+                          const DynInstPtr &pred_inst);
+    /// MPINHO 17-oct-2026 END ///
+
     /** Returns true if vector instruction is of type that can be fused. */
     bool isFuseType(const DynInstPtr &inst);
 
@@ -119,6 +147,24 @@ class WidthDecoder
     /** Returns true if the two instructions are compatible for fuse. */
     bool canFuseInst(const DynInstPtr &inst1, const DynInstPtr &inst2);
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Returns true if an instruction can be packed with the instructions
+     * already resident in a FU, according to the packing policy.
+     */
+    bool canPackInst(const PackingSlot &slot, const DynInstPtr &inst);
+
+    /** Packs an instruction with the ones already resident in a FU. */
+    void packInst(PackingSlot &slot, const DynInstPtr &inst);
+
+    /**
+     * Returns true if an instruction can only be packed with the resident
+     * ones by placing elements in lanes other than their own
+     * (multi-element packing).
+     */
+    bool isMultiElementFuse(const PackingSlot &slot, const DynInstPtr &inst);
+    /// MPINHO 17-oct-2026 END ///
+
     VecWidthCode widthOp1VectorRegl(const DynInstPtr &inst,
                                     uint8_t q, uint8_t size,
                                     uint8_t op1);
@@ -166,6 +212,10 @@ class WidthDecoder
     VecWidthCode widthOp1ImmBroadcast(const DynInstPtr &inst,
                                       uint8_t q, uint8_t size,
                                       uint64_t val);
+    /// MPINHO 17-oct-2026 BEGIN ///
+    VecWidthCode widthGprScalar(const DynInstPtr &inst,
+                                uint8_t size, uint64_t imm);
+    /// MPINHO 17-oct-2026 END ///
 
   protected:
     std::string _name;
@@ -173,8 +223,32 @@ class WidthDecoder
     /** Pointer to the CPU. */
     O3CPU *cpu;
 
-    /** Pointer to the Instruction Queue. */
-    InstructionQueue<Impl> *iqPtr;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Pointer to the precision board. */
+    PrecisionBoard *precBoard;
+
+    /** Width mask of a source register, used when there is no board. */
+    VecWidthCode scratchView;
+
+    /**
+     * Builds the width mask of a vector register value, read with lanes
+     * of 8 << size bits.
+     */
+    VecWidthCode regSizeWidthView(const TheISA::VecRegContainer &reg,
+                                  uint8_t size);
+
+    /** Builds the width mask of a vector register value, by lane. */
+    template <int Size, typename Elem>
+    VecWidthCode regWidthView(const TheISA::VecRegContainer &reg,
+                              int nBits);
+
+    /**
+     * Returns the width mask of a vector source register, read with lanes
+     * of 8 << size bits. Taken from the precision board, if possible.
+     */
+    const VecWidthCode &srcRegWidthView(const DynInstPtr &inst,
+                                        uint8_t op, uint8_t size);
+    /// MPINHO 17-oct-2026 END ///
 
     template <int Size, typename Elem>
     VecWidthCode
@@ -199,12 +273,22 @@ class WidthDecoder
     ///////////////////
     /** Definition for operand and operation width/resolution. */
     WidthDefinition widthDef;
-    std::function<int(uint64_t)> prcFunc;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Resolution function of the width definition. */
+    int (*prcFunc)(uint64_t);
+    /// MPINHO 17-oct-2026 END ///
 
     /** Block size for width/resolution considerations. */
     unsigned blockSize;
-    std::function<int(int, int)> roundFunc;
-    std::function<int(uint64_t)> roundedPrcFunc;
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Returns the resolution of a value, rounded to the block size. */
+    int
+    roundedPrc(uint64_t val) const
+    {
+        return roundPrcBlock(prcFunc(val), blockSize);
+    }
+    /// MPINHO 17-oct-2026 END ///
 
     /** Policy for packing operations. */
     WidthPackingPolicy packingPolicy;
@@ -218,28 +302,64 @@ class WidthDecoder
     PackingCriteria packingCriteria;
     /// MPINHO 13-may-2019 END ///
 
-    /** Decode instruction width. */
-    WidthInfo decode(const DynInstPtr &inst);
+    /** Decode instruction width shape. */
+    WidthShape decode(const DynInstPtr &inst);
     /** Decode Neon 3Same instruction width. */
-    WidthInfo decodeNeon3Same(const DynInstPtr &inst);
+    WidthShape decodeNeon3Same(const DynInstPtr &inst);
     /** Decode Neon 3Same instruction width. */
-    WidthInfo decodeNeon3Diff(const DynInstPtr &inst);
+    WidthShape decodeNeon3Diff(const DynInstPtr &inst);
     /** Decode Neon 2RegMisc instruction width. */
-    WidthInfo decodeNeon2RegMisc(const DynInstPtr &inst);
+    WidthShape decodeNeon2RegMisc(const DynInstPtr &inst);
     /** Decode Neon AcrossLanes instruction width. */
-    WidthInfo decodeNeonAcrossLanes(const DynInstPtr &inst);
+    WidthShape decodeNeonAcrossLanes(const DynInstPtr &inst);
     /** Decode Neon ShiftByImm instruction width. */
-    WidthInfo decodeNeonShiftByImm(const DynInstPtr &inst);
+    WidthShape decodeNeonShiftByImm(const DynInstPtr &inst);
     /** Decode Neon ModImm instruction width. */
-    WidthInfo decodeNeonModImm(const DynInstPtr &inst);
+    WidthShape decodeNeonModImm(const DynInstPtr &inst);
     /** Decode Neon Copy instruction width. */
-    WidthInfo decodeNeonCopy(const DynInstPtr &inst);
+    WidthShape decodeNeonCopy(const DynInstPtr &inst);
     /** Decode Neon Ext instruction width. */
-    WidthInfo decodeNeonExt(const DynInstPtr &inst);
+    WidthShape decodeNeonExt(const DynInstPtr &inst);
     /** Decode Neon ZipUzpTrn instruction width. */
-    WidthInfo decodeNeonZipUzpTrn(const DynInstPtr &inst);
+    WidthShape decodeNeonZipUzpTrn(const DynInstPtr &inst);
     /** Decode Neon TblTbx instruction width. */
-    WidthInfo decodeNeonTblTbx(const DynInstPtr &inst);
+    WidthShape decodeNeonTblTbx(const DynInstPtr &inst);
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Decode scalar integer data processing instruction width. */
+    WidthShape decodeIntDataProc(const DynInstPtr &inst);
+
+    /**
+     * Returns the width of a scalar integer value, as seen by an operation
+     * of nBits.
+     */
+    int gprWidth(uint64_t val, int nBits);
+    /// MPINHO 17-oct-2026 END ///
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /**
+     * Returns the width shape of an instruction, decoding it if needed.
+     * Lookups for the width prediction at dispatch are counted apart from
+     * those for the width information at issue.
+     */
+    const WidthShape &lookupShape(const DynInstPtr &inst,
+                                  bool predict = false);
+
+    /** Builds the width mask of an instruction from its operand shape. */
+    VecWidthCode operandWidthMask(const DynInstPtr &inst,
+                                  const OperandShape &operands);
+
+    /**
+     * Width shapes already decoded, indexed by the machine instruction,
+     * since the shape only depends on the instruction encoding.
+     */
+    std::unordered_map<uint64_t, WidthShape> shapeCache;
+
+    /** Predictor of the width of fuseable instructions. */
+    WidthPredictor widthPred;
+
+    /** Trains the width predictor with the width of an instruction. */
+    void trainWidthPredictor(const DynInstPtr &inst);
+    /// MPINHO 17-oct-2026 END ///
 
     /////////////////////////
     // Consts
@@ -270,10 +390,45 @@ class WidthDecoder
     /** Stat for total vector inst width, by width class. */
     Stats::VectorDistribution statVectorInstTotalWidthByClass;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    /** Number of width shapes found in the shape cache. */
+    Stats::Scalar statShapeCacheHits;
+    /** Number of width shapes that had to be decoded. */
+    Stats::Scalar statShapeCacheMisses;
+    /** Number of width shapes found in the shape cache, to predict. */
+    Stats::Scalar statPredShapeCacheHits;
+    /** Number of width shapes that had to be decoded, to predict. */
+    Stats::Scalar statPredShapeCacheMisses;
+    /** Number of source widths found in the precision board. */
+    Stats::Scalar statBoardHits;
+    /** Number of source widths computed from the register value. */
+    Stats::Scalar statBoardMisses;
+    /** Number of vector register widths written in the board. */
+    Stats::Scalar statBoardWrites;
+    /** Register slices needed by each vector register written. */
+    Stats::Distribution statBoardSlices;
+    /** Number of vector register writes that fit in half the slices. */
+    Stats::Scalar statBoardNarrowWrites;
+    /** Fraction of vector register writes that fit in half the slices. */
+    Stats::Formula statBoardNarrowWritesNorm;
+    /** Number of fuseable insts looked up in the width predictor. */
+    Stats::Scalar statWidthPredLookups;
+    /** Number of fuseable insts tagged with a predicted width. */
+    Stats::Scalar statWidthPredTagged;
+    /** Number of predicted widths that covered the actual width. */
+    Stats::Scalar statWidthPredCorrect;
+    /** Number of predicted widths that did not cover the actual width. */
+    Stats::Scalar statWidthPredIncorrect;
+    /** Fraction of predicted widths that covered the actual width. */
+    Stats::Formula statWidthPredAccuracy;
+    /** Fraction of fuseable insts tagged with a predicted width. */
+    Stats::Formula statWidthPredCoverage;
+    /// MPINHO 17-oct-2026 END ///
+
     /** Sample width distribution for vector operands. */
-    void sampleVecOp(VecWidthCode &mask, uint8_t size);
+    void sampleVecOp(const VecWidthCode &mask, uint8_t size);
     /** Sample width distribution for vector insts. */
-    void sampleVecInst(VecWidthCode &mask, uint8_t size);
+    void sampleVecInst(const VecWidthCode &mask, uint8_t size);
 };
 
 template<class Impl>
@@ -288,5 +443,5 @@ const std::array<const VecElemSize, 4>
     VecElemSize::Bit32,
     VecElemSize::Bit64
   };
-#endif // __CPU_O3_WIDTH_DECODER_BOARD_HH__
+#endif // __CPU_WIDTH_DECODER_HH__
 /// MPINHO 12-mar-2019 END ///
@@ -1,103 +1,31 @@
 /// MPINHO 12-mar-2019 BEGIN ///
-#ifndef __CPU_O3_WIDTH_DECODER_IMPL_HH__
-#define __CPU_O3_WIDTH_DECODER_IMPL_HH__
+#ifndef __CPU_WIDTH_DECODER_IMPL_HH__
+#define __CPU_WIDTH_DECODER_IMPL_HH__
 
 #include "arch/arm/generated/decoder.hh" /// MPINHO 17-jul-2019 END ///
 #include "arch/generic/vec_reg.hh"
 #include "arch/utility.hh"
 #include "base/bitfield.hh"
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/resolution.hh"
 #include "base/trace.hh"
-#include "cpu/o3/comm.hh"
-#include "cpu/o3/inst_queue.hh"
-#include "cpu/o3/width_decoder.hh"
 #include "cpu/reg_class.hh"
+#include "cpu/width_decoder.hh"
 #include "debug/WidthDecoder.hh"
 #include "debug/WidthDecoderDecode.hh"
 #include "debug/WidthDecoderWidth.hh"
 #include "enums/OpClass.hh"
-#include "params/DerivO3CPU.hh"
 
 template <class Impl>
 WidthDecoder<Impl>::WidthDecoder()
-    : iqPtr(NULL)
+    : cpu(NULL),
+      /// MPINHO 17-oct-2026 BEGIN ///
+      precBoard(NULL),
+      prcFunc(NULL)
+      /// MPINHO 17-oct-2026 END ///
 {}
 
-/// MPINHO 11-may-2019 BEGIN ///
-template <class Impl>
-WidthDecoder<Impl>::WidthDecoder(O3CPU *cpu_ptr, DerivO3CPUParams *params)
-    : _name(params->name + ".widthdecoder"),
-      cpu(cpu_ptr),
-      iqPtr(NULL),
-      widthDef(params->widthDefinition),
-      blockSize(params->widthBlockSize),
-      packingPolicy(params->widthPackingPolicy)
-{
-    DPRINTF(WidthDecoder, "Creating WidthDecoder object.\n");
-
-    /** Parameters */
-    widthDef = params->widthDefinition;
-    blockSize = params->widthBlockSize;
-    packingPolicy = params->widthPackingPolicy;
-
-    // blockSize must be a power of 2.
-    if (!(blockSize && ((blockSize & (blockSize-1)) == 0))) {
-        fatal("Block size (%u) must be a power of 2.",
-              blockSize);
-    }
-
-    // Set width definition function.
-    switch (widthDef) {
-        case WidthDefinition::Unsigned :
-            prcFunc = unsignedIntResolution;
-            break;
-
-        case WidthDefinition::Signed :
-            prcFunc = signedIntResolution;
-            break;
-
-        default:
-            panic("\"%s\" unimplemented width definition.",
-                WidthDefinitionStrings[static_cast<int>(widthDef)]);
-            break;
-    }
-
-    // Set width rounding function based on the block size.
-    roundFunc = roundPrcBlock;
-    roundedPrcFunc =
-        std::bind(roundFunc, std::bind(prcFunc, std::placeholders::_1),
-                  blockSize);
-
-    // Set packing policy function.
-    switch (packingPolicy) {
-        case WidthPackingPolicy::Disabled :
-            packingCriteria =
-                [] (VecWidthCode a, VecWidthCode b) { return false; };
-            break;
-
-        case WidthPackingPolicy::Simple :
-            packingCriteria = simplePacking;
-            break;
-
-        case WidthPackingPolicy::Optimal :
-            packingCriteria = optimalPacking;
-            break;
-
-        default:
-            panic("\"%s\" packing criteria is not implemented.",
-                  WidthPackingPolicyStrings[static_cast<int>(packingPolicy)]);
-            break;
-    }
-
-    DPRINTF(WidthDecoder, "\tWidth definition: %s.\n",
-            WidthDefinitionStrings[static_cast<int>(widthDef)]);
-    DPRINTF(WidthDecoder, "\tBlock size: %u (bits)).\n", blockSize);
-    DPRINTF(WidthDecoder, "\tPacking policy: %s.\n",
-            WidthPackingPolicyStrings[static_cast<int>(packingPolicy)]);
-}
-/// MPINHO 11-may-2019 END ///
-
 template <class Impl>
 void
 WidthDecoder<Impl>::setCPU(O3CPU *cpu_ptr)
@@ -105,29 +33,48 @@ WidthDecoder<Impl>::setCPU(O3CPU *cpu_ptr)
     cpu = cpu_ptr;
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
 template <class Impl>
 void
-WidthDecoder<Impl>::setIQ(InstructionQueue<Impl> *iq_ptr)
+WidthDecoder<Impl>::setPrecisionBoard(PrecisionBoard *pb_ptr)
 {
-    iqPtr = iq_ptr;
+    precBoard = pb_ptr;
 }
+/// MPINHO 17-oct-2026 END ///
 
 template <class Impl>
 WidthDecoder<Impl>::~WidthDecoder() {}
 
+/// MPINHO 17-oct-2026 BEGIN ///
 template <class Impl>
 void
-WidthDecoder<Impl>::init(DerivO3CPUParams *params)
+WidthDecoder<Impl>::initPredictor(unsigned size, unsigned counter_bits,
+                                  unsigned threshold)
+{
+    widthPred.init(size, counter_bits, threshold);
+}
+
+template <class Impl>
+void
+WidthDecoder<Impl>::init(const std::string &base_name,
+                         WidthDefinition width_def, unsigned block_size,
+                         WidthPackingPolicy packing_policy)
 {
      DPRINTF(WidthDecoder, "Creating WidthDecoder object.\n");
 
-    _name = csprintf("%s.widthDecoder", params->name);
+    _name = csprintf("%s.widthDecoder", base_name);
 
     /// MPINHO 08-may-2019 BEGIN ///
     /** Parameters */
-    widthDef = params->widthDefinition;
-    blockSize = params->widthBlockSize;
-    packingPolicy = params->widthPackingPolicy;
+    widthDef = width_def;
+    blockSize = block_size;
+    packingPolicy = packing_policy;
+
+    // blockSize must be a power of 2.
+    if (!(blockSize && ((blockSize & (blockSize-1)) == 0))) {
+        fatal("Block size (%u) must be a power of 2.",
+              blockSize);
+    }
 
     // Set width definition function.
     switch (widthDef) {
@@ -145,17 +92,10 @@ WidthDecoder<Impl>::init(DerivO3CPUParams *params)
         break;
     }
 
-    // Set width rounding function based on the block size.
-    roundFunc = roundPrcBlock;
-    roundedPrcFunc =
-        std::bind(roundFunc, std::bind(prcFunc, std::placeholders::_1),
-                  blockSize);
-
     // Set packing policy function.
     switch (packingPolicy) {
         case WidthPackingPolicy::Disabled :
-            packingCriteria =
-                [] (VecWidthCode a, VecWidthCode b) { return false; };
+            packingCriteria = disabledPacking;
             break;
 
         case WidthPackingPolicy::Simple :
@@ -166,6 +106,10 @@ WidthDecoder<Impl>::init(DerivO3CPUParams *params)
             packingCriteria = optimalPacking;
             break;
 
+        case WidthPackingPolicy::MultiElement :
+            packingCriteria = multiElementPacking;
+            break;
+
         default:
             panic("\"%s\" packing criteria is not implemented.",
                   WidthPackingPolicyStrings[static_cast<int>(packingPolicy)]);
@@ -179,6 +123,7 @@ WidthDecoder<Impl>::init(DerivO3CPUParams *params)
             WidthPackingPolicyStrings[static_cast<int>(packingPolicy)]);
     /// MPINHO 08-may-2019 END ///
 }
+/// MPINHO 17-oct-2026 END ///
 
 template <class Impl>
 void
@@ -228,6 +173,85 @@ WidthDecoder<Impl>::regStats()
     for (int i = 0; i < Num_WidthClass; i++) {
         statVectorInstTotalWidthByClass.subname(i, WidthClassStrings[i]);
     }
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    statShapeCacheHits
+        .name(name() + ".statShapeCacheHits")
+        .desc("Number of width shapes found in the shape cache.")
+        ;
+    statShapeCacheMisses
+        .name(name() + ".statShapeCacheMisses")
+        .desc("Number of width shapes decoded from the encoding.")
+        ;
+    statPredShapeCacheHits
+        .name(name() + ".statPredShapeCacheHits")
+        .desc("Number of width shapes found in the shape cache for the"
+              " width prediction.")
+        ;
+    statPredShapeCacheMisses
+        .name(name() + ".statPredShapeCacheMisses")
+        .desc("Number of width shapes decoded from the encoding for the"
+              " width prediction.")
+        ;
+    statBoardHits
+        .name(name() + ".statBoardHits")
+        .desc("Number of source widths found in the precision board.")
+        ;
+    statBoardMisses
+        .name(name() + ".statBoardMisses")
+        .desc("Number of source widths computed from the register value.")
+        ;
+    statBoardWrites
+        .name(name() + ".statBoardWrites")
+        .desc("Number of vector register widths written in the board.")
+        ;
+    statBoardSlices
+        .init(1, PrecisionBoard::NumSlices, 1)
+        .name(name() + ".statBoardSlices")
+        .desc("Register slices needed by each vector register written.")
+        .flags(Stats::pdf)
+        ;
+    statBoardNarrowWrites
+        .name(name() + ".statBoardNarrowWrites")
+        .desc("Number of vector register writes that fit in half the"
+              " register slices.")
+        ;
+    statBoardNarrowWritesNorm
+        .name(name() + ".statBoardNarrowWritesNorm")
+        .desc("Fraction of vector register writes that fit in half the"
+              " register slices.")
+        ;
+    statBoardNarrowWritesNorm = statBoardNarrowWrites / statBoardWrites;
+
+    statWidthPredLookups
+        .name(name() + ".statWidthPredLookups")
+        .desc("Number of fuseable insts looked up in the width predictor.")
+        ;
+    statWidthPredTagged
+        .name(name() + ".statWidthPredTagged")
+        .desc("Number of fuseable insts tagged with a predicted width.")
+        ;
+    statWidthPredCorrect
+        .name(name() + ".statWidthPredCorrect")
+        .desc("Number of predicted widths that covered the actual width.")
+        ;
+    statWidthPredIncorrect
+        .name(name() + ".statWidthPredIncorrect")
+        .desc("Number of predicted widths that did not cover the actual"
+              " width.")
+        ;
+    statWidthPredAccuracy
+        .name(name() + ".statWidthPredAccuracy")
+        .desc("Fraction of predicted widths that covered the actual width.")
+        ;
+    statWidthPredAccuracy = statWidthPredCorrect /
+        (statWidthPredCorrect + statWidthPredIncorrect);
+    statWidthPredCoverage
+        .name(name() + ".statWidthPredCoverage")
+        .desc("Fraction of fuseable insts tagged with a predicted width.")
+        ;
+    statWidthPredCoverage = statWidthPredTagged / statWidthPredLookups;
+    /// MPINHO 17-oct-2026 END ///
 }
 
 /**
@@ -240,7 +264,7 @@ WidthDecoder<Impl>::intSrcRegWidth(const DynInstPtr &inst,
 {
     uint64_t val = inst->readIntRegOperand(inst->staticInst.get(),
                                            op);
-    int rsl = roundedPrcFunc(val);
+    int rsl = roundedPrc(val);
 
     DPRINTF(WidthDecoderWidth, "    Gpr reg: val=%llx, rsl=%d\n",
             val, rsl);
@@ -392,6 +416,119 @@ WidthDecoder<Impl>::vecSrcRegWidthMaskBroadcast(const DynInstPtr &inst,
     return mask;
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+template <int Size, typename Elem>
+VecWidthCode
+WidthDecoder<Impl>::regWidthView(const TheISA::VecRegContainer &reg,
+                                 int nBits)
+{
+    VecWidthCode mask(Size, nBits);
+
+    // All the lanes are scanned at once, straight from the register.
+    std::array<uint8_t, Size> rsl;
+    laneIntResolution(reg.template raw_ptr<Elem>(), Size, sizeof(Elem),
+                      widthDef == WidthDefinition::Signed, blockSize,
+                      rsl.data());
+
+    for (size_t i = 0; i < Size; i++)
+    {
+        assert(rsl[i] <= nBits);
+
+        mask.set(i, rsl[i]);
+    }
+
+    return mask;
+}
+
+template <class Impl>
+VecWidthCode
+WidthDecoder<Impl>::regSizeWidthView(const TheISA::VecRegContainer &reg,
+                                     uint8_t size)
+{
+    switch (size) {
+      case 0:
+        return regWidthView<16, int8_t>(reg, 8);
+      case 1:
+        return regWidthView<8, int16_t>(reg, 16);
+      case 2:
+        return regWidthView<4, int32_t>(reg, 32);
+      case 3:
+        return regWidthView<2, int64_t>(reg, 64);
+      default:
+        panic("Unknown eSize %d.", size);
+    }
+}
+
+template <class Impl>
+const VecWidthCode &
+WidthDecoder<Impl>::srcRegWidthView(const DynInstPtr &inst, uint8_t op,
+                                    uint8_t size)
+{
+    PhysRegIdPtr phys_reg = inst->renamedSrcRegIdx(op);
+
+    if (precBoard && precBoard->hasWidthVecReg(phys_reg, size)) {
+        statBoardHits++;
+        return precBoard->getWidthVecReg(phys_reg, size);
+    }
+
+    statBoardMisses++;
+
+    // The register was not written back through the board (e.g. initial
+    // architectural state), or its producer had another element size. As
+    // the source is ready, its value is final and the mask can be recorded
+    // for the following consumers. The value is read without counting a
+    // register file access, as it is not one of the pipeline.
+    scratchView = regSizeWidthView(
+        inst->readVecRegOperandNoStats(inst->staticInst.get(), op), size);
+
+    if (precBoard) {
+        precBoard->addWidthVecReg(phys_reg, scratchView, size);
+        return precBoard->getWidthVecReg(phys_reg, size);
+    }
+
+    return scratchView;
+}
+
+template <class Impl>
+void
+WidthDecoder<Impl>::writebackWidth(const DynInstPtr &inst)
+{
+    if (!precBoard || !inst->isVector())
+        return;
+
+    // Slices are counted with the element size of the producer, or as
+    // 64-bit lanes if it is unknown.
+    uint8_t size = 3;
+    const WidthInfo &width = inst->getWidth();
+    if (width.hasWidthInfo() && width.getElemSize() != VecElemSize::Unknown)
+        size = static_cast<int>(width.getElemSize()) - 1;
+
+    for (int i = 0; i < inst->numDestRegs(); i++) {
+        PhysRegIdPtr phys_reg = inst->renamedDestRegIdx(i);
+
+        if (!phys_reg->isVectorPhysReg() || phys_reg->isFixedMapping())
+            continue;
+
+        const VecWidthCode view =
+            regSizeWidthView(cpu->readVecRegNoStats(phys_reg), size);
+        precBoard->setWidthVecReg(phys_reg, view, size);
+
+        int slices = precBoard->getSlicesVecReg(phys_reg);
+
+        statBoardWrites++;
+        statBoardSlices.sample(slices);
+        if (slices <= PrecisionBoard::NumSlices / 2)
+            statBoardNarrowWrites++;
+
+        DPRINTF(WidthDecoderWidth, "Reg %i (%s) written with %d slices:"
+                " %s.\n",
+                phys_reg->index(), phys_reg->className(), slices,
+                view.to_string());
+    }
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 template <int Size, typename Elem>
 VecWidthCode
@@ -402,17 +539,15 @@ WidthDecoder<Impl>::getWidthVecReg(const DynInstPtr &inst, int nElem,
 
     VecWidthCode mask(Size, nBits);
 
-    // FIXME: this count as an invalid access to the register, in terms of
-    // stats?? Create proxy access function?
-    const VecRegT<Elem, Size, true> &vsrc =
-        inst->readVecRegOperand(inst->staticInst.get(), op);
+    const VecWidthCode &view =
+        srcRegWidthView(inst, op, floorLog2(sizeof(Elem)));
 
     for (size_t i = 0; i < nElem; i++)
     {
-        int rsl = roundedPrcFunc((uint64_t) (int64_t) vsrc[i]);
+        int rsl = view.get(i);
 
-        DPRINTF(WidthDecoderWidth, "    Vec Lane %i: val=%llx, rsl=%d\n",
-                i, (int64_t) vsrc[i], rsl);
+        DPRINTF(WidthDecoderWidth, "    Vec Lane %i: rsl=%d\n",
+                i, rsl);
 
         assert(rsl <= nBits);
 
@@ -433,17 +568,15 @@ WidthDecoder<Impl>::getWidthVecRegIndex(const DynInstPtr &inst,
 
     VecWidthCode mask(Size, nBits);
 
-    // FIXME: this count as an invalid access to the register, in terms of
-    // stats?? Create proxy access function?
-    const VecRegT<Elem, Size, true> &vsrc =
-        inst->readVecRegOperand(inst->staticInst.get(), op);
+    const VecWidthCode &view =
+        srcRegWidthView(inst, op, floorLog2(sizeof(Elem)));
 
-    int rsl = roundedPrcFunc((uint64_t) (int64_t) vsrc[idx]);
+    int rsl = view.get(idx);
 
     assert(rsl <= nBits);
 
-    DPRINTF(WidthDecoderWidth, "    Vec Lane %i: val=%llx, rsl=%d\n",
-            idx, (int64_t) vsrc[idx], rsl);
+    DPRINTF(WidthDecoderWidth, "    Vec Lane %i: rsl=%d\n",
+            idx, rsl);
 
     mask.set(idx, rsl);
 
@@ -462,19 +595,17 @@ WidthDecoder<Impl>::getWidthVecRegBroadcast(const DynInstPtr &inst,
 
     VecWidthCode mask(Size, nBits);
 
-    // FIXME: this count as an invalid access to the register, in terms of
-    // stats?? Create proxy access function?
-    const VecRegT<Elem, Size, true> &vsrc =
-        inst->readVecRegOperand(inst->staticInst.get(), op);
+    const VecWidthCode &view =
+        srcRegWidthView(inst, op, floorLog2(sizeof(Elem)));
 
-    int rsl = roundedPrcFunc((uint64_t) (int64_t) vsrc[idx]);
+    int rsl = view.get(idx);
 
     assert(rsl <= nBits);
 
     for (size_t i = 0; i < nElem; i++)
     {
-        DPRINTF(WidthDecoderWidth, "    Vec Lane %i: val=%llx, rsl=%d\n",
-                i, (int64_t) vsrc[idx], rsl);
+        DPRINTF(WidthDecoderWidth, "    Vec Lane %i: rsl=%d\n",
+                i, rsl);
 
         mask.set(i, rsl);
     }
@@ -492,19 +623,17 @@ WidthDecoder<Impl>::getWidthVecRegWiden(const DynInstPtr &inst, int nElem,
 
     int bias = low ? 0 : nElem;
 
-    // FIXME: this count as an invalid access to the register, in terms of
-    // stats?? Create proxy access function?
-    const VecRegT<Elem, Size, true> &vsrc =
-        inst->readVecRegOperand(inst->staticInst.get(), op);
+    const VecWidthCode &view =
+        srcRegWidthView(inst, op, floorLog2(sizeof(Elem)));
 
     for (size_t i = 0; i < nElem; i++)
     {
-        int rsl = roundedPrcFunc((uint64_t) (int64_t) vsrc[bias + i]);
+        int rsl = view.get(bias + i);
 
         assert(rsl <= nBits);
 
-        DPRINTF(WidthDecoderWidth, "    Vec Lane %i: val=%d, rsl=%d\n",
-                i, (int) vsrc[i], rsl);
+        DPRINTF(WidthDecoderWidth, "    Vec Lane %i: rsl=%d\n",
+                i, rsl);
 
         mask.set(i, rsl);
     }
@@ -512,12 +641,87 @@ WidthDecoder<Impl>::getWidthVecRegWiden(const DynInstPtr &inst, int nElem,
     return mask;
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+const WidthShape &
+WidthDecoder<Impl>::lookupShape(const DynInstPtr &inst, bool predict)
+{
+    uint64_t key = inst->staticInst->machInst;
+
+    auto it = shapeCache.find(key);
+    if (it != shapeCache.end()) {
+        ++(predict ? statPredShapeCacheHits : statShapeCacheHits);
+        return it->second;
+    }
+
+    ++(predict ? statPredShapeCacheMisses : statShapeCacheMisses);
+    return shapeCache.emplace(key, decode(inst)).first->second;
+}
+
+template <class Impl>
+VecWidthCode
+WidthDecoder<Impl>::operandWidthMask(const DynInstPtr &inst,
+                                     const OperandShape &ops)
+{
+    switch (ops.kind) {
+      case OperandShape::Op1VectorRegl:
+        return widthOp1VectorRegl(inst, ops.q, ops.size, ops.op1);
+      case OperandShape::Op1VectorLong:
+        return widthOp1VectorLong(inst, ops.q, ops.size, ops.op1);
+      case OperandShape::Op1VectorPairLong:
+        return widthOp1VectorPairLong(inst, ops.q, ops.size, ops.op1);
+      case OperandShape::Op1VectorAcross:
+        return widthOp1VectorAcross(inst, ops.q, ops.size, ops.op1);
+      case OperandShape::Op1VectorIndex:
+        return widthOp1VectorIndex(inst, ops.size, ops.op1, ops.idx);
+      case OperandShape::Op1VectorBroadcast:
+        return widthOp1VectorBroadcast(inst, ops.q, ops.size, ops.op1,
+                                       ops.idx);
+      case OperandShape::Op1GprBroadcast:
+        return widthOp1GprBroadcast(inst, ops.q, ops.size, ops.op1);
+      case OperandShape::Op1ImmBroadcast:
+        return widthOp1ImmBroadcast(inst, ops.q, ops.size, ops.imm);
+      case OperandShape::Op2VectorRegl:
+        return widthOp2VectorRegl(inst, ops.q, ops.size, ops.op1, ops.op2);
+      case OperandShape::Op2VectorPair:
+        return widthOp2VectorPair(inst, ops.q, ops.size, ops.op1, ops.op2);
+      case OperandShape::Op2VectorMix:
+        return widthOp2VectorMix(inst, ops.q, ops.size, ops.op1, ops.op2,
+                                 ops.idx, ops.stride);
+      case OperandShape::Op2VectorJoin:
+        return widthOp2VectorJoin(inst, ops.q, ops.size, ops.op1, ops.op2,
+                                  ops.lower);
+      case OperandShape::Op2VectorLong:
+        return widthOp2VectorLong(inst, ops.q, ops.size, ops.op1, ops.op2);
+      case OperandShape::Op2VectorWide:
+        return widthOp2VectorWide(inst, ops.q, ops.size, ops.op1, ops.op2);
+      case OperandShape::GprScalar:
+        return widthGprScalar(inst, ops.size, ops.imm);
+      default:
+        panic("Invalid operand shape: %d.", ops.kind);
+    }
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 void
 WidthDecoder<Impl>::addWidthInfo(const DynInstPtr &inst)
 {
-    WidthInfo width = decode(inst);
-    inst->setWidth(width);
+    /// MPINHO 17-oct-2026 BEGIN ///
+    // Only the value dependent width mask is computed for each dynamic
+    // instance; the rest comes from the shape of the static instruction.
+    const WidthShape &shape = lookupShape(inst);
+    if (shape.hasOperands()) {
+        inst->setWidth(WidthInfo(shape.getWidthClass(),
+                                 operandWidthMask(inst,
+                                                  shape.getOperands()),
+                                 shape.getSize()));
+    } else {
+        inst->setWidth(WidthInfo(shape.getWidthClass()));
+    }
+
+    trainWidthPredictor(inst);
+    /// MPINHO 17-oct-2026 END ///
 
     statVectorInstTotalWidthByClass[(int) inst->getWidthClass()]
         .sample(inst->getWidthVal());
@@ -529,6 +733,84 @@ WidthDecoder<Impl>::addWidthInfo(const DynInstPtr &inst)
             inst->getWidth().to_string());
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+void
+WidthDecoder<Impl>::predictWidth(const DynInstPtr &inst)
+{
+    // The width class does not depend on the operand values, so only the
+    // instructions that may fuse go to the predictor.
+    if (!WidthInfo(lookupShape(inst, true).getWidthClass()).isFuseType())
+        return;
+
+    statWidthPredLookups++;
+
+    WidthInfo pred_width;
+    if (widthPred.lookup(inst->instAddr(), pred_width)) {
+        statWidthPredTagged++;
+        inst->setPredWidth(pred_width);
+
+        DPRINTF(WidthDecoder, "Instruction \"%s\" was predicted width"
+                " information: \"%s\".\n",
+                inst->staticInst->disassemble(inst->instAddr()),
+                pred_width.to_string());
+    }
+}
+
+template <class Impl>
+void
+WidthDecoder<Impl>::trainWidthPredictor(const DynInstPtr &inst)
+{
+    const WidthInfo &inst_width = inst->getWidth();
+
+    if (!inst_width.isFuseType() || !widthPred.enabled())
+        return;
+
+    if (inst->hasPredWidth()) {
+        if (WidthPredictor::covers(inst->getPredWidth(), inst_width)) {
+            statWidthPredCorrect++;
+        } else {
+            statWidthPredIncorrect++;
+            DPRINTF(WidthDecoder, "Instruction \"%s\" mispredicted width"
+                    " \"%s\", actual \"%s\".\n",
+                    inst->staticInst->disassemble(inst->instAddr()),
+                    inst->getPredWidth().to_string(),
+                    inst_width.to_string());
+        }
+    }
+
+    widthPred.update(inst->instAddr(), inst_width);
+}
+
+template <class Impl>
+bool
+WidthDecoder<Impl>::canFusePredicted(const DynInstPtr &inst,
+                                     const DynInstPtr &pred_inst)
+{
+    const WidthInfo &inst_width = inst->getWidth();
+    const WidthInfo &pred_width = pred_inst->getPredWidth();
+
+    if (!inst_width.matchType(pred_width))
+        return false;
+
+    // Same element size rules as matchFuseType.
+    switch (packingPolicy) {
+        case WidthPackingPolicy::Disabled :
+            return false;
+
+        case WidthPackingPolicy::Optimal :
+            break;
+
+        default:
+            if (inst_width.getElemSize() != pred_width.getElemSize())
+                return false;
+            break;
+    }
+
+    return inst_width.canFuse(pred_width, packingCriteria);
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 bool
 WidthDecoder<Impl>::isFuseType(const DynInstPtr &inst)
@@ -541,15 +823,29 @@ bool
 WidthDecoder<Impl>::matchFuseType(const DynInstPtr &inst1,
                                   const DynInstPtr &inst2)
 {
-    WidthInfo inst1_width = inst1->getWidth();
-    WidthInfo inst2_width = inst2->getWidth();
+    const WidthInfo &inst1_width = inst1->getWidth();
+    const WidthInfo &inst2_width = inst2->getWidth();
 
     DPRINTF(WidthDecoder, "Checking if \"%s\" and \"%s\" match.\n",
             inst1->staticInst->disassemble(inst1->instAddr()),
             inst2->staticInst->disassemble(inst2->instAddr()));
 
-    // TODO: Use chosen packing.
-    return inst1_width.matchType(inst2_width);
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (!inst1_width.matchType(inst2_width))
+        return false;
+
+    // Only the optimal packing can mix different element sizes.
+    switch (packingPolicy) {
+        case WidthPackingPolicy::Disabled :
+            return false;
+
+        case WidthPackingPolicy::Optimal :
+            return true;
+
+        default:
+            return inst1_width.getElemSize() == inst2_width.getElemSize();
+    }
+    /// MPINHO 17-oct-2026 END ///
 }
 
 template <class Impl>
@@ -557,19 +853,60 @@ bool
 WidthDecoder<Impl>::canFuseInst(const DynInstPtr &inst1,
                                 const DynInstPtr &inst2)
 {
-    WidthInfo inst1_width = inst1->getWidth();
-    WidthInfo inst2_width = inst2->getWidth();
+    const WidthInfo &inst1_width = inst1->getWidth();
+    const WidthInfo &inst2_width = inst2->getWidth();
 
     DPRINTF(WidthDecoder, "Trying to fuse \"%s\" and \"%s\".\n",
             inst1->staticInst->disassemble(inst1->instAddr()),
             inst2->staticInst->disassemble(inst2->instAddr()));
 
-    // TODO: Use chosen packing.
-    return inst1_width.canFuse(inst2_width, optimalPacking);
+    return inst1_width.canFuse(inst2_width, packingCriteria);
+}
+
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+bool
+WidthDecoder<Impl>::canPackInst(const PackingSlot &slot,
+                                const DynInstPtr &inst)
+{
+    const WidthInfo &inst_width = inst->getWidth();
+
+    DPRINTF(WidthDecoder, "Trying to pack \"%s\" (%s) with %d resident"
+            " insts (%s).\n",
+            inst->staticInst->disassemble(inst->instAddr()),
+            inst_width.getWidthMask().to_string(),
+            slot.numResident(),
+            slot.getOccupancy().to_string());
+
+    return slot.canPack(inst_width.getWidthMask(), packingCriteria);
 }
 
 template <class Impl>
-WidthInfo
+void
+WidthDecoder<Impl>::packInst(PackingSlot &slot, const DynInstPtr &inst)
+{
+    const WidthInfo &inst_width = inst->getWidth();
+
+    slot.pack(inst_width.getWidthMask(), packingCriteria);
+}
+
+template <class Impl>
+bool
+WidthDecoder<Impl>::isMultiElementFuse(const PackingSlot &slot,
+                                       const DynInstPtr &inst)
+{
+    if (packingPolicy != WidthPackingPolicy::MultiElement || slot.empty())
+        return false;
+
+    const WidthInfo &inst_width = inst->getWidth();
+
+    // Multi-element fuse only if lane aligned packing is not enough.
+    return !simplePacking(slot.getOccupancy(), inst_width.getWidthMask());
+}
+/// MPINHO 17-oct-2026 END ///
+
+template <class Impl>
+WidthShape
 WidthDecoder<Impl>::decode(const DynInstPtr &inst)
 {
     using namespace ArmISAInst;
@@ -596,10 +933,10 @@ WidthDecoder<Impl>::decode(const DynInstPtr &inst)
                                         " inst decoded: %s.\n",
                                         inst->staticInst->disassemble(
                                             inst->instAddr()));
-                                return(WidthInfo(WidthClass::SimdNoInfo));
+                                return(WidthShape(WidthClass::SimdNoInfo));
                             } else if (bits(machInst, 23) == 1) {
                                 // Nop.
-                                return(WidthInfo(WidthClass::NoInfo));
+                                return(WidthShape(WidthClass::NoInfo));
                             } else {
                                 if (bits(machInst, 22, 19)) {
                                     // Neon ShiftByImm.
@@ -699,29 +1036,121 @@ WidthDecoder<Impl>::decode(const DynInstPtr &inst)
                             "AdvSimd Scalar inst decoded: %s.\n",
                             inst->staticInst->disassemble(
                                 inst->instAddr()));
-                    return(WidthInfo(WidthClass::SimdNoInfo));
+                    return(WidthShape(WidthClass::SimdNoInfo));
                 } else {
                     // Other AdvSimd inst.
                     DPRINTF(WidthDecoderDecode,
                             "Other AdvSimd inst decoded: %s.\n",
                             inst->staticInst->disassemble(
                                 inst->instAddr()));
-                    return(WidthInfo());
+                    return(WidthShape());
                 }
             }
 
-            return(WidthInfo());
+            /// MPINHO 17-oct-2026 BEGIN ///
+            if (bits(machInst, 28, 26) == 0x4 ||
+                bits(machInst, 27, 25) == 0x5) {
+                // bit 28:26=100 -> DP immediate; bit 27:25=101 -> DP
+                // register.
+                DPRINTF(WidthDecoderDecode,
+                        "Integer DataProc inst decoded: %s.\n",
+                        inst->staticInst->disassemble(
+                            inst->instAddr()));
+                return decodeIntDataProc(inst);
+            }
+            /// MPINHO 17-oct-2026 END ///
+
+            return(WidthShape());
         }
     }
 
     DPRINTF(WidthDecoderDecode,
             "Non AARCH64 inst decoded: %s.\n",
             inst->staticInst->disassemble(inst->instAddr()));
-    return(WidthInfo());
+    return(WidthShape());
 }
 
+/// MPINHO 17-oct-2026 BEGIN ///
 template <class Impl>
-WidthInfo
+WidthShape
+WidthDecoder<Impl>::decodeIntDataProc(const DynInstPtr &inst)
+{
+    ArmISA::ExtMachInst machInst = inst->staticInst->machInst;
+
+    uint8_t sf = bits(machInst, 31);
+    uint8_t size = sf ? 3 : 2;
+
+    if (bits(machInst, 28, 26) == 0x4) {
+        // DP immediate.
+        switch (bits(machInst, 25, 23)) {
+          case 0x2: {
+            // Add/sub (immediate): ADD, ADDS, SUB, SUBS.
+            uint64_t imm = bits(machInst, 21, 10);
+            if (bits(machInst, 22))
+                imm <<= 12;
+            return WidthShape(WidthClass::IntPackingAlu,
+                              OperandShape::gprScalar(size, imm),
+                              size);
+          }
+          case 0x5: {
+            // Move wide (immediate): only MOVZ, as MOVK also reads the
+            // destination and MOVN inverts the immediate.
+            uint8_t hw = bits(machInst, 22, 21);
+            if (bits(machInst, 30, 29) != 0x2 || (!sf && hw > 1))
+                return WidthShape(WidthClass::NoInfo);
+            uint64_t imm = (uint64_t)bits(machInst, 20, 5) << (16 * hw);
+            return WidthShape(WidthClass::IntPackingAlu,
+                              OperandShape::gprScalar(size, imm),
+                              size);
+          }
+          default:
+            // PC-rel, logical, bitfield and extract.
+            return WidthShape(WidthClass::NoInfo);
+        }
+    }
+
+    if (bits(machInst, 28) == 0) {
+        // Logical and add/sub (shifted register). Only without shift and
+        // with the second operand not inverted, so the result is no wider
+        // than the operands.
+        if (bits(machInst, 21) == 0 && bits(machInst, 15, 10) == 0) {
+            return WidthShape(WidthClass::IntPackingAlu,
+                              OperandShape::gprScalar(size, 0),
+                              size);
+        }
+        return WidthShape(WidthClass::NoInfo);
+    }
+
+    if (bits(machInst, 24) == 1 && bits(machInst, 30, 29) == 0) {
+        // DP 3-source.
+        switch (bits(machInst, 23, 21)) {
+          case 0x0:
+            // MADD, MSUB.
+            return WidthShape(WidthClass::IntPackingMult,
+                              OperandShape::gprScalar(size, 0),
+                              size);
+          case 0x1:
+          case 0x5:
+            // SMADDL, SMSUBL, UMADDL, UMSUBL.
+            if (!sf)
+                return WidthShape(WidthClass::NoInfo);
+            return WidthShape(WidthClass::IntPackingMult,
+                              OperandShape::gprScalar(size, 0),
+                              size);
+          default:
+            // SMULH, UMULH.
+            return WidthShape(WidthClass::NoInfo);
+        }
+    }
+
+    // Add/sub with carry, conditional compare and select, DP 1-source and
+    // 2-source.
+    return WidthShape(WidthClass::NoInfo);
+}
+/// MPINHO 17-oct-2026 END ///
+
+template <class Impl>
+WidthShape
 WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
 {
     using namespace ArmISAInst;
@@ -743,8 +1172,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         "Neon HADD inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorRegl(q, size, 2, 3),
                                  size));
             }
             break;
@@ -755,8 +1184,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         "Neon QADD inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                OperandShape::op2VectorRegl(q, size, 2, 3),
                                 size));
             }
             break;
@@ -767,8 +1196,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         "Neon RHADD inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorRegl(q, size, 2, 3),
                                  size));
             }
             break;
@@ -783,8 +1212,9 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                             "Neon EOR inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             size_bw, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                                    widthOp2VectorRegl(inst, q, size_bw, 2, 3),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                                    OperandShape::op2VectorRegl(q, size_bw,
+                                                                2, 3),
                                     size_bw));
                 } else {
                     // AndQX, AndDX
@@ -792,8 +1222,9 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                             "Neon AND inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             size_bw, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                                    widthOp2VectorRegl(inst, q, size_bw, 2, 3),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                                    OperandShape::op2VectorRegl(q, size_bw,
+                                                                2, 3),
                                     size_bw));
                 }
                 break;
@@ -804,8 +1235,9 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                             "Neon BSL inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             size_bw, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                                    widthOp2VectorRegl(inst, q, size_bw, 2, 3),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                                    OperandShape::op2VectorRegl(q, size_bw,
+                                                                2, 3),
                                     size_bw));
                 } else {
                     // BicQX, BicDX
@@ -813,8 +1245,9 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                             "Neon BIC inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             size_bw, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                                    widthOp2VectorRegl(inst, q, size_bw, 2, 3),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                                    OperandShape::op2VectorRegl(q, size_bw,
+                                                                2, 3),
                                     size_bw));
                 }
                 break;
@@ -825,8 +1258,9 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                             "Neon BIT inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             size_bw, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                                    widthOp2VectorRegl(inst, q, size_bw, 2, 3),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                                    OperandShape::op2VectorRegl(q, size_bw,
+                                                                2, 3),
                                     size_bw));
                 } else {
                     // OrrQX, OrrDX
@@ -834,8 +1268,9 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                             "Neon ORR inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             size_bw, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                                    widthOp2VectorRegl(inst, q, size_bw, 2, 3),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                                    OperandShape::op2VectorRegl(q, size_bw,
+                                                                2, 3),
                                     size_bw));
                 }
                 break;
@@ -846,8 +1281,9 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                             "Neon BIF inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             size_bw, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                                    widthOp2VectorRegl(inst, q, size_bw, 2, 3),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                                    OperandShape::op2VectorRegl(q, size_bw,
+                                                                2, 3),
                                     size_bw));
                 } else {
                     // OrnQX, OrnDX
@@ -855,8 +1291,9 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                             "Neon ORN inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             size_bw, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                                    widthOp2VectorRegl(inst, q, size_bw, 2, 3),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                                    OperandShape::op2VectorRegl(q, size_bw,
+                                                                2, 3),
                                     size_bw));
                 }
                 break;
@@ -870,8 +1307,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         "Neon HSUB inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                OperandShape::op2VectorRegl(q, size, 2, 3),
                                 size));
             }
             break;
@@ -882,8 +1319,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         "Neon QSUB inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorRegl(q, size, 2, 3),
                                  size));
             }
             break;
@@ -895,8 +1332,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         (u) ? "CMHI" : "CMGT",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorRegl(q, size, 2, 3),
                                  size));
             }
             break;
@@ -908,8 +1345,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         (u) ? "CMHS" : "CMGE",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorRegl(q, size, 2, 3),
                                  size));
             }
             break;
@@ -920,8 +1357,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         "Neon MAX inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorRegl(q, size, 2, 3),
                                  size));
             }
             break;
@@ -932,8 +1369,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         "Neon MIN inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorRegl(q, size, 2, 3),
                                  size));
             }
             break;
@@ -944,8 +1381,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         "Neon ABA inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorRegl(q, size, 2, 3),
                                  size));
             }
             break;
@@ -956,8 +1393,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         "Neon ABA inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorRegl(q, size, 2, 3),
                                  size));
             }
             break;
@@ -969,8 +1406,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         (u) ? "SUB" : "ADD",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorRegl(q, size, 2, 3),
                                  size));
             }
             break;
@@ -982,8 +1419,9 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                             "Neon CMEQ inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             size, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                                     widthOp2VectorRegl(inst, q, size, 2, 3),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                                     OperandShape::op2VectorRegl(q, size,
+                                                                 2, 3),
                                      size));
                 } else {
                     // CmtstDX, CmtstQX
@@ -991,8 +1429,9 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                             "Neon CMTST inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             size, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                                     widthOp2VectorRegl(inst, q, size, 2, 3),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                                     OperandShape::op2VectorRegl(q, size,
+                                                                 2, 3),
                                      size));
                 }
             }
@@ -1005,8 +1444,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         (u) ? "MLS" : "MLA",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingMult,
-                                 widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingMult,
+                                 OperandShape::op2VectorRegl(q, size, 2, 3),
                                  size));
             }
             break;
@@ -1017,8 +1456,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         "Neon MUL inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingMult,
-                                 widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingMult,
+                                 OperandShape::op2VectorRegl(q, size, 2, 3),
                                  size));
             }
             break;
@@ -1029,8 +1468,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         "Neon MAXP inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorPair(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorPair(q, size, 2, 3),
                                  size));
             }
             break;
@@ -1041,8 +1480,8 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         "Neon MINP inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorPair(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorPair(q, size, 2, 3),
                                  size));
             }
             break;
@@ -1054,32 +1493,32 @@ WidthDecoder<Impl>::decodeNeon3Same(const DynInstPtr &inst)
                         (u) ? "SQRDMULH" : "SQDMULH",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingMult,
-                                 widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingMult,
+                                 OperandShape::op2VectorRegl(q, size, 2, 3),
                                  size));
             }
             break;
         case 0x17:
             if (u || size_q == 0x6) {
-                return(WidthInfo());
+                return(WidthShape());
             } else {
                 // AddpDX, AddpQX
                 DPRINTF(WidthDecoderDecode,
                         "Neon ADDP inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorPair(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorPair(q, size, 2, 3),
                                  size));
             }
             break;
     }
 
-    return(WidthInfo(WidthClass::SimdNoInfo));
+    return(WidthShape(WidthClass::SimdNoInfo));
 }
 
 template <class Impl>
-WidthInfo
+WidthShape
 WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
 {
     using namespace ArmISAInst;
@@ -1099,8 +1538,8 @@ WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
                         "Neon ADDL inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorLong(inst, q, size+1, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorLong(q, size+1, 2, 3),
                                  size+1));
             }
             break;
@@ -1111,8 +1550,8 @@ WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
                         "Neon ADDW inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorWide(inst, q, size+1, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorWide(q, size+1, 2, 3),
                                  size+1));
             }
             break;
@@ -1123,8 +1562,8 @@ WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
                         "Neon SUBL inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorLong(inst, q, size+1, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorLong(q, size+1, 2, 3),
                                  size+1));
             }
             break;
@@ -1135,8 +1574,8 @@ WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
                         "Neon SUBW inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorWide(inst, q, size+1, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorWide(q, size+1, 2, 3),
                                  size+1));
             }
             break;
@@ -1147,8 +1586,8 @@ WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
                         "Neon ADDHN inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorRegl(inst, 1, size+1, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorRegl(1, size+1, 2, 3),
                                  size+1));
             }
             break;
@@ -1159,8 +1598,8 @@ WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
                         "Neon ABAL inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorLong(inst, q, size+1, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorLong(q, size+1, 2, 3),
                                  size+1));
             }
             break;
@@ -1171,8 +1610,8 @@ WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
                         "Neon SUBHN inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorRegl(inst, 1, size+1, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorRegl(1, size+1, 2, 3),
                                  size+1));
             }
             break;
@@ -1183,8 +1622,8 @@ WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
                         "Neon ABDL inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorLong(inst, q, size+1, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorLong(q, size+1, 2, 3),
                                  size+1));
             }
             break;
@@ -1195,8 +1634,8 @@ WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
                         "Neon MLAL inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingMult,
-                                 widthOp2VectorLong(inst, q, size+1, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingMult,
+                                 OperandShape::op2VectorLong(q, size+1, 2, 3),
                                  size+1));
             }
             break;
@@ -1207,8 +1646,8 @@ WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
                         "Neon SQDMLAL inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingMult,
-                                 widthOp2VectorLong(inst, q, size+1, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingMult,
+                                 OperandShape::op2VectorLong(q, size+1, 2, 3),
                                  size+1));
             }
             break;
@@ -1219,8 +1658,8 @@ WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
                         "Neon MLSL inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingMult,
-                                 widthOp2VectorLong(inst, q, size+1, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingMult,
+                                 OperandShape::op2VectorLong(q, size+1, 2, 3),
                                  size+1));
             }
             break;
@@ -1231,8 +1670,8 @@ WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
                         "Neon SQDMLSL inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingMult,
-                                 widthOp2VectorLong(inst, q, size+1, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingMult,
+                                 OperandShape::op2VectorLong(q, size+1, 2, 3),
                                  size+1));
             }
             break;
@@ -1243,8 +1682,8 @@ WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
                         "Neon MULL inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingMult,
-                                 widthOp2VectorLong(inst, q, size+1, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingMult,
+                                 OperandShape::op2VectorLong(q, size+1, 2, 3),
                                  size+1));
             }
             break;
@@ -1255,18 +1694,18 @@ WidthDecoder<Impl>::decodeNeon3Diff(const DynInstPtr &inst)
                         "Neon SQDMULL inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingMult,
-                                 widthOp2VectorLong(inst, q, size+1, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingMult,
+                                 OperandShape::op2VectorLong(q, size+1, 2, 3),
                                  size+1));
             }
             break;
     }
 
-    return(WidthInfo(WidthClass::SimdNoInfo));
+    return(WidthShape(WidthClass::SimdNoInfo));
 }
 
 template <class Impl>
-WidthInfo
+WidthShape
 WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
 {
     using namespace ArmISAInst;
@@ -1291,8 +1730,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon REV64 inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x01:
@@ -1302,8 +1742,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon REV16 inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x02:
@@ -1313,8 +1754,8 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon ADDLP inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorPairLong(inst, q, size, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorPairLong(q, size, 2),
                                  size+1));
             }
             break;
@@ -1325,8 +1766,8 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon SUQADD inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                OperandShape::op2VectorRegl(q, size, 2, 3),
                                 size));
             }
             break;
@@ -1337,8 +1778,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon CLS inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x05:
@@ -1348,8 +1790,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon CNT inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x06:
@@ -1359,8 +1802,8 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon ADALP inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorPairLong(inst, q, size, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorPairLong(q, size, 2),
                                  size+1));
             }
             break;
@@ -1371,8 +1814,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon ABS inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x08:
@@ -1382,8 +1826,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon CMGT(zero) inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x09:
@@ -1393,8 +1838,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon CMEQ(zero) inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x0a:
@@ -1404,8 +1850,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon CMLT(zero) inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x0b:
@@ -1415,8 +1862,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon ABS inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x12:
@@ -1426,8 +1874,8 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon XTN inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, 1, size+1, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(1, size+1, 2),
                                  size+1));
             }
             break;
@@ -1438,8 +1886,8 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon SQXTN inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, 1, size+1, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(1, size+1, 2),
                                  size+1));
             }
             break;
@@ -1452,8 +1900,8 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon CVT inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         sizeCvt, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, sizeCvt, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, sizeCvt, 2),
                                  sizeCvt));
             }
             break;
@@ -1464,8 +1912,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon REV32 inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x22:
@@ -1475,8 +1924,8 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon ADDLP inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorPairLong(inst, q, size, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorPairLong(q, size, 2),
                                  size+1));
             }
             break;
@@ -1487,8 +1936,8 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon USQADD inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp2VectorRegl(inst, q, size, 2, 3),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op2VectorRegl(q, size, 2, 3),
                                  size));
             }
             break;
@@ -1499,8 +1948,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon CLZ inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x26:
@@ -1510,8 +1960,8 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon ADALP inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorPairLong(inst, q, size, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorPairLong(q, size, 2),
                                  size+1));
             }
             break;
@@ -1522,8 +1972,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon SQNEG inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x28:
@@ -1533,8 +1984,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon CMGE(zero) inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x29:
@@ -1544,8 +1996,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon CMLE(zero) inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x2b:
@@ -1555,8 +2008,9 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon NEG inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x32:
@@ -1566,8 +2020,8 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon SQXTUN inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, 1, size+1, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(1, size+1, 2),
                                  size+1));
             }
             break;
@@ -1578,8 +2032,8 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon SHLL inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorLong(inst, q, size+1, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorLong(q, size+1, 2),
                                                     size+1));
             }
             break;
@@ -1590,8 +2044,8 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon UQXTN inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, 1, size+1, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(1, size+1, 2),
                                  size+1));
             }
             break;
@@ -1604,18 +2058,18 @@ WidthDecoder<Impl>::decodeNeon2RegMisc(const DynInstPtr &inst)
                         "Neon CVT inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         sizeCvt, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, sizeCvt, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, sizeCvt, 2),
                                  sizeCvt));
             }
             break;
     }
 
-    return(WidthInfo(WidthClass::SimdNoInfo));
+    return(WidthShape(WidthClass::SimdNoInfo));
 }
 
 template <class Impl>
-WidthInfo
+WidthShape
 WidthDecoder<Impl>::decodeNeonAcrossLanes(const DynInstPtr &inst)
 {
     using namespace ArmISAInst;
@@ -1638,8 +2092,8 @@ WidthDecoder<Impl>::decodeNeonAcrossLanes(const DynInstPtr &inst)
                         "Neon SMAX inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorAcross(inst, q, size, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorAcross(q, size, 2),
                                  size));
             }
             break;
@@ -1650,8 +2104,8 @@ WidthDecoder<Impl>::decodeNeonAcrossLanes(const DynInstPtr &inst)
                         "Neon SMIN inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorAcross(inst, q, size, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorAcross(q, size, 2),
                                  size));
             }
             break;
@@ -1662,8 +2116,8 @@ WidthDecoder<Impl>::decodeNeonAcrossLanes(const DynInstPtr &inst)
                         "Neon ADDV inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorAcross(inst, q, size, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorAcross(q, size, 2),
                                  size));
             }
             break;
@@ -1674,8 +2128,8 @@ WidthDecoder<Impl>::decodeNeonAcrossLanes(const DynInstPtr &inst)
                         "Neon UMAX inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorAcross(inst, q, size, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorAcross(q, size, 2),
                                  size));
             }
             break;
@@ -1686,18 +2140,18 @@ WidthDecoder<Impl>::decodeNeonAcrossLanes(const DynInstPtr &inst)
                         "Neon UMIN inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorAcross(inst, q, size, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorAcross(q, size, 2),
                                  size));
             }
             break;
     }
 
-    return(WidthInfo(WidthClass::SimdNoInfo));
+    return(WidthShape(WidthClass::SimdNoInfo));
 }
 
 template <class Impl>
-WidthInfo
+WidthShape
 WidthDecoder<Impl>::decodeNeonShiftByImm(const DynInstPtr &inst)
 {
     using namespace ArmISAInst;
@@ -1723,8 +2177,9 @@ WidthDecoder<Impl>::decodeNeonShiftByImm(const DynInstPtr &inst)
                         (u) ? "USHR" : "SSHR",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x02:
@@ -1735,8 +2190,9 @@ WidthDecoder<Impl>::decodeNeonShiftByImm(const DynInstPtr &inst)
                         (u) ? "USRA" : "SSRA",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x04:
@@ -1747,8 +2203,9 @@ WidthDecoder<Impl>::decodeNeonShiftByImm(const DynInstPtr &inst)
                         (u) ? "URSHR" : "SRSHR",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x06:
@@ -1759,8 +2216,9 @@ WidthDecoder<Impl>::decodeNeonShiftByImm(const DynInstPtr &inst)
                         (u) ? "URSRA" : "SRSRA",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2), size));
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
+                                 size));
             }
             break;
         case 0x0a:
@@ -1771,8 +2229,8 @@ WidthDecoder<Impl>::decodeNeonShiftByImm(const DynInstPtr &inst)
                             "Neon SHL inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             size, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                                     widthOp1VectorRegl(inst, q, size, 2),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                                     OperandShape::op1VectorRegl(q, size, 2),
                                                        size));
                 }
             }
@@ -1784,8 +2242,8 @@ WidthDecoder<Impl>::decodeNeonShiftByImm(const DynInstPtr &inst)
                         "Neon SQSHLU inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
                                                     size));
             }
             break;
@@ -1796,8 +2254,8 @@ WidthDecoder<Impl>::decodeNeonShiftByImm(const DynInstPtr &inst)
                         "Neon QSHL inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, size, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, size, 2),
                                                     size));
             }
             break;
@@ -1809,8 +2267,8 @@ WidthDecoder<Impl>::decodeNeonShiftByImm(const DynInstPtr &inst)
                         (u) ? "SQSHRUN" : "SHRN",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, 1, size+1, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(1, size+1, 2),
                                                     size+1));
             }
             break;
@@ -1822,8 +2280,8 @@ WidthDecoder<Impl>::decodeNeonShiftByImm(const DynInstPtr &inst)
                         (u) ? "RSQSHRUN" : "RSHRN",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, 1, size+1, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(1, size+1, 2),
                                                     size+1));
             }
             break;
@@ -1835,8 +2293,8 @@ WidthDecoder<Impl>::decodeNeonShiftByImm(const DynInstPtr &inst)
                         (u) ? "UQSHRN" : "SQSHRN",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, 1, size+1, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(1, size+1, 2),
                                                     size+1));
             }
             break;
@@ -1848,8 +2306,8 @@ WidthDecoder<Impl>::decodeNeonShiftByImm(const DynInstPtr &inst)
                         (u) ? "UQRSHRN" : "SQRSHRN",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, 1, size+1, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(1, size+1, 2),
                                                     size+1));
             }
             break;
@@ -1860,8 +2318,8 @@ WidthDecoder<Impl>::decodeNeonShiftByImm(const DynInstPtr &inst)
                         "Neon SHLL inst decoded: %s. Size: %d, 2: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         size+1, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorLong(inst, q, size+1, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorLong(q, size+1, 2),
                                                     size+1));
             }
             break;
@@ -1874,19 +2332,19 @@ WidthDecoder<Impl>::decodeNeonShiftByImm(const DynInstPtr &inst)
                         "Neon CVT inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         sizeCvt, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1VectorRegl(inst, q, sizeCvt, 2),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1VectorRegl(q, sizeCvt, 2),
                                                     sizeCvt));
             }
             break;
         // TODO: Remaining shift insts.
     }
 
-    return(WidthInfo(WidthClass::SimdNoInfo));
+    return(WidthShape(WidthClass::SimdNoInfo));
 }
 
 template <class Impl>
-WidthInfo
+WidthShape
 WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
 {
     using namespace ArmISAInst;
@@ -1901,14 +2359,14 @@ WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
     uint8_t o2 = bits(machInst, 11);
 
     if (o2 == 0x1 || (op == 0x1 && cmode == 0xf && !q))
-        return(WidthInfo(WidthClass::SimdNoInfo));
+        return(WidthShape(WidthClass::SimdNoInfo));
 
     bool immValid = true;
     const uint64_t bigImm = simd_modified_imm(op, cmode, abcdefgh,
                                                 immValid,
                                                 true /* isAarch64 */);
     if (!immValid) {
-        return(WidthInfo(WidthClass::SimdNoInfo));
+        return(WidthShape(WidthClass::SimdNoInfo));
     }
 
     if (op) {
@@ -1919,8 +2377,8 @@ WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
                         "Neon MVNI inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         0x3, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1ImmBroadcast(inst, q, 0x3, bigImm),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1ImmBroadcast(q, 0x3, bigImm),
                                                       0x3));
             } else {
                 // BicImmDX, BicImmQX
@@ -1928,8 +2386,8 @@ WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
                         "Neon BIC inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         0x3, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                 widthOp1ImmBroadcast(inst, q, 0x3, bigImm),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                 OperandShape::op1ImmBroadcast(q, 0x3, bigImm),
                                                       0x3));
             }
         } else {
@@ -1942,8 +2400,9 @@ WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
                             "Neon MVNI inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             0x3, q);
-                        return(WidthInfo(WidthClass::SimdPackingAlu,
-                                   widthOp1ImmBroadcast(inst, q, 0x3, bigImm),
+                        return(WidthShape(WidthClass::SimdPackingAlu,
+                                   OperandShape::op1ImmBroadcast(q, 0x3,
+                                                                 bigImm),
                                                         0x3));
                         break;
                     case 2:
@@ -1952,8 +2411,9 @@ WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
                             "Neon MOVI inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             0x3, q);
-                        return(WidthInfo(WidthClass::SimdPackingAlu,
-                                   widthOp1ImmBroadcast(inst, q, 0x3, bigImm),
+                        return(WidthShape(WidthClass::SimdPackingAlu,
+                                   OperandShape::op1ImmBroadcast(q, 0x3,
+                                                                 bigImm),
                                                         0x3));
                         break;
                     case 3:
@@ -1963,8 +2423,9 @@ WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
                               "Neon MOVI inst decoded: %s. Size: %d, Q: %d.\n",
                               inst->staticInst->disassemble(inst->instAddr()),
                               0x3, q);
-                            return(WidthInfo(WidthClass::SimdPackingAlu,
-                                    widthOp1ImmBroadcast(inst, q, 0x3, bigImm),
+                            return(WidthShape(WidthClass::SimdPackingAlu,
+                                    OperandShape::op1ImmBroadcast(q, 0x3,
+                                                                  bigImm),
                                                          0x3));
                         }
                         break;
@@ -1976,8 +2437,8 @@ WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
                             "Neon MVNI inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             0x3, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                             widthOp1ImmBroadcast(inst, q, 0x3, bigImm),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                             OperandShape::op1ImmBroadcast(q, 0x3, bigImm),
                                                   0x3));
                 } else {
                     // BicImmDX, BicImmQX
@@ -1985,8 +2446,8 @@ WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
                             "Neon BIC inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             0x3, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                             widthOp1ImmBroadcast(inst, q, 0x3, bigImm),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                             OperandShape::op1ImmBroadcast(q, 0x3, bigImm),
                                                   0x3));
                 }
             }
@@ -1999,8 +2460,9 @@ WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
                         "Neon MOVI inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         0x3, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                    widthOp1ImmBroadcast(inst, q, 0x3, bigImm),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                    OperandShape::op1ImmBroadcast(q, 0x3,
+                                                                  bigImm),
                                                          0x3));
             } else {
                 // OrrImmDX, OrrImmQX
@@ -2008,8 +2470,8 @@ WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
                         "Neon ORR inst decoded: %s. Size: %d, Q: %d.\n",
                         inst->staticInst->disassemble(inst->instAddr()),
                         0x3, q);
-                return(WidthInfo(WidthClass::SimdPackingAlu,
-                                widthOp1ImmBroadcast(inst, q, 0x3, bigImm),
+                return(WidthShape(WidthClass::SimdPackingAlu,
+                                OperandShape::op1ImmBroadcast(q, 0x3, bigImm),
                                                      0x3));
             }
         } else {
@@ -2020,8 +2482,8 @@ WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
                             "Neon MOVI inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             0x3, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                             widthOp1ImmBroadcast(inst, q, 0x3, bigImm),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                             OperandShape::op1ImmBroadcast(q, 0x3, bigImm),
                                                   0x3));
                 }
             } else {
@@ -2031,8 +2493,8 @@ WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
                             "Neon MOVI inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             0x3, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                             widthOp1ImmBroadcast(inst, q, 0x3, bigImm),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                             OperandShape::op1ImmBroadcast(q, 0x3, bigImm),
                                                   0x3));
                 } else {
                     // OrrImmDX, OrrImmQX
@@ -2040,8 +2502,9 @@ WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
                             "Neon ORR inst decoded: %s. Size: %d, Q: %d.\n",
                             inst->staticInst->disassemble(inst->instAddr()),
                             0x3, q);
-                    return(WidthInfo(WidthClass::SimdPackingAlu,
-                                    widthOp1ImmBroadcast(inst, q, 0x3, bigImm),
+                    return(WidthShape(WidthClass::SimdPackingAlu,
+                                    OperandShape::op1ImmBroadcast(q, 0x3,
+                                                                  bigImm),
                                                          0x3));
                 }
             }
@@ -2049,11 +2512,11 @@ WidthDecoder<Impl>::decodeNeonModImm(const DynInstPtr &inst)
     }
 
 
-    return(WidthInfo(WidthClass::SimdNoInfo));
+    return(WidthShape(WidthClass::SimdNoInfo));
 }
 
 template <class Impl>
-WidthInfo
+WidthShape
 WidthDecoder<Impl>::decodeNeonCopy(const DynInstPtr &inst)
 {
     using namespace ArmISAInst;
@@ -2071,20 +2534,20 @@ WidthDecoder<Impl>::decodeNeonCopy(const DynInstPtr &inst)
 
     if (op) {
         if (!q || (imm4 & mask(imm5_pos)))
-            return(WidthInfo(WidthClass::SimdNoInfo));
+            return(WidthShape(WidthClass::SimdNoInfo));
 
         index = bits(imm4, 3, imm5_pos);
         size = imm5_pos;
         if (size > 3) {
-            return(WidthInfo(WidthClass::SimdNoInfo));
+            return(WidthShape(WidthClass::SimdNoInfo));
         }
 
         DPRINTF(WidthDecoderDecode,
                 "Neon INS inst decoded: %s. Size: %d.\n",
                 inst->staticInst->disassemble(inst->instAddr()),
                 size);
-        return(WidthInfo(WidthClass::SimdPackingAlu,
-                        widthOp1VectorIndex(inst, size, 2, index),
+        return(WidthShape(WidthClass::SimdPackingAlu,
+                        OperandShape::op1VectorIndex(size, 2, index),
                         size));
     }
 
@@ -2093,15 +2556,16 @@ WidthDecoder<Impl>::decodeNeonCopy(const DynInstPtr &inst)
             index = bits(imm5, 4, imm5_pos + 1);
             size = imm5_pos;
             if (size > 3) {
-                return(WidthInfo(WidthClass::SimdNoInfo));
+                return(WidthShape(WidthClass::SimdNoInfo));
             }
 
             DPRINTF(WidthDecoderDecode,
                     "Neon DUP inst decoded: %s. Size: %d. Q: %d.\n",
                     inst->staticInst->disassemble(inst->instAddr()),
                     size, q);
-            return(WidthInfo(WidthClass::SimdPackingAlu,
-                             widthOp1VectorBroadcast(inst, q, size, 2, index),
+            return(WidthShape(WidthClass::SimdPackingAlu,
+                             OperandShape::op1VectorBroadcast(q, size, 2,
+                                                              index),
                              size));
             break;
         case 0x1:
@@ -2119,57 +2583,57 @@ WidthDecoder<Impl>::decodeNeonCopy(const DynInstPtr &inst)
                 size = 0x3;
                 break;
               default:
-                return(WidthInfo(WidthClass::SimdNoInfo));
+                return(WidthShape(WidthClass::SimdNoInfo));
             }
 
             DPRINTF(WidthDecoderDecode,
                     "Neon DUP (gpr) inst decoded: %s. Size: %d. Q: %d.\n",
                     inst->staticInst->disassemble(inst->instAddr()),
                     size, q);
-            return(WidthInfo(WidthClass::SimdPackingAlu,
-                             widthOp1GprBroadcast(inst, q, size, 2),
+            return(WidthShape(WidthClass::SimdPackingAlu,
+                             OperandShape::op1GprBroadcast(q, size, 2),
                              size));
             break;
         case 0x5:
             index = bits(imm5, 4, imm5_pos + 1);
             size = imm5_pos;
             if (size > 2) {
-                return(WidthInfo(WidthClass::SimdNoInfo));
+                return(WidthShape(WidthClass::SimdNoInfo));
             }
 
             DPRINTF(WidthDecoderDecode,
                     "Neon SMOV inst decoded: %s. Size: %d.\n",
                     inst->staticInst->disassemble(inst->instAddr()),
                     size);
-            return(WidthInfo(WidthClass::SimdPackingAlu,
-                            widthOp1VectorIndex(inst, size, 2, index),
+            return(WidthShape(WidthClass::SimdPackingAlu,
+                            OperandShape::op1VectorIndex(size, 2, index),
                             size));
             break;
         case 0x7:
             index = imm5 >> (imm5_pos + 1);
             size = imm5_pos;
             if (size > 3) {
-                return(WidthInfo(WidthClass::SimdNoInfo));
+                return(WidthShape(WidthClass::SimdNoInfo));
             }
 
             if ((q && imm5_pos != 3) || (!q && imm5_pos >= 3))
-                return(WidthInfo(WidthClass::SimdNoInfo));
+                return(WidthShape(WidthClass::SimdNoInfo));
 
             DPRINTF(WidthDecoderDecode,
                     "Neon UMOV inst decoded: %s. Size: %d.\n",
                     inst->staticInst->disassemble(inst->instAddr()),
                     size);
-            return(WidthInfo(WidthClass::SimdPackingAlu,
-                            widthOp1VectorIndex(inst, size, 2, index),
+            return(WidthShape(WidthClass::SimdPackingAlu,
+                            OperandShape::op1VectorIndex(size, 2, index),
                             size));
             break;
     }
 
-    return(WidthInfo(WidthClass::SimdNoInfo));
+    return(WidthShape(WidthClass::SimdNoInfo));
 }
 
 template <class Impl>
-WidthInfo
+WidthShape
 WidthDecoder<Impl>::decodeNeonExt(const DynInstPtr &inst)
 {
     using namespace ArmISAInst;
@@ -2183,19 +2647,19 @@ WidthDecoder<Impl>::decodeNeonExt(const DynInstPtr &inst)
     uint8_t index = q ? imm4 : imm4 & 0x7;
 
     if (op2 != 0 || (q == 0x0 && bits(imm4, 3) == 0x1))
-        return(WidthInfo(WidthClass::SimdNoInfo));
+        return(WidthShape(WidthClass::SimdNoInfo));
 
     DPRINTF(WidthDecoderDecode,
             "Neon EXT inst decoded: %s. Size: %d, Q: %d.\n",
             inst->staticInst->disassemble(inst->instAddr()),
             0x0, q);
-    return(WidthInfo(WidthClass::SimdPackingAlu,
-                    widthOp2VectorMix(inst, q, 0x0, 2, 3, index, 1),
+    return(WidthShape(WidthClass::SimdPackingAlu,
+                    OperandShape::op2VectorMix(q, 0x0, 2, 3, index, 1),
                     0x0));
 }
 
 template <class Impl>
-WidthInfo
+WidthShape
 WidthDecoder<Impl>::decodeNeonZipUzpTrn(const DynInstPtr &inst)
 {
     using namespace ArmISAInst;
@@ -2212,8 +2676,8 @@ WidthDecoder<Impl>::decodeNeonZipUzpTrn(const DynInstPtr &inst)
                     "Neon UZP1 inst decoded: %s. Size: %d, Q: %d.\n",
                     inst->staticInst->disassemble(inst->instAddr()),
                     size, q);
-            return(WidthInfo(WidthClass::SimdPackingAlu,
-                            widthOp2VectorMix(inst, q, size, 2, 3, 1, 1),
+            return(WidthShape(WidthClass::SimdPackingAlu,
+                            OperandShape::op2VectorMix(q, size, 2, 3, 1, 1),
                             size));
             break;
         case 0x2:
@@ -2221,8 +2685,8 @@ WidthDecoder<Impl>::decodeNeonZipUzpTrn(const DynInstPtr &inst)
                     "Neon TRN1 inst decoded: %s. Size: %d, Q: %d.\n",
                     inst->staticInst->disassemble(inst->instAddr()),
                     size, q);
-            return(WidthInfo(WidthClass::SimdPackingAlu,
-                            widthOp2VectorMix(inst, q, size, 2, 3, 1, 1),
+            return(WidthShape(WidthClass::SimdPackingAlu,
+                            OperandShape::op2VectorMix(q, size, 2, 3, 1, 1),
                             size));
             break;
         case 0x3:
@@ -2230,8 +2694,8 @@ WidthDecoder<Impl>::decodeNeonZipUzpTrn(const DynInstPtr &inst)
                     "Neon ZIP1 inst decoded: %s. Size: %d, Q: %d.\n",
                     inst->staticInst->disassemble(inst->instAddr()),
                     size, q);
-            return(WidthInfo(WidthClass::SimdPackingAlu,
-                            widthOp2VectorJoin(inst, q, size, 2, 3, false),
+            return(WidthShape(WidthClass::SimdPackingAlu,
+                            OperandShape::op2VectorJoin(q, size, 2, 3, false),
                             size));
             break;
         case 0x5:
@@ -2239,8 +2703,8 @@ WidthDecoder<Impl>::decodeNeonZipUzpTrn(const DynInstPtr &inst)
                     "Neon UZP2 inst decoded: %s. Size: %d, Q: %d.\n",
                     inst->staticInst->disassemble(inst->instAddr()),
                     size, q);
-            return(WidthInfo(WidthClass::SimdPackingAlu,
-                            widthOp2VectorMix(inst, q, size, 2, 3, 0, 1),
+            return(WidthShape(WidthClass::SimdPackingAlu,
+                            OperandShape::op2VectorMix(q, size, 2, 3, 0, 1),
                             size));
             break;
         case 0x6:
@@ -2248,8 +2712,8 @@ WidthDecoder<Impl>::decodeNeonZipUzpTrn(const DynInstPtr &inst)
                     "Neon TRN2 inst decoded: %s. Size: %d, Q: %d.\n",
                     inst->staticInst->disassemble(inst->instAddr()),
                     size, q);
-            return(WidthInfo(WidthClass::SimdPackingAlu,
-                            widthOp2VectorMix(inst, q, size, 2, 3, 0, 1),
+            return(WidthShape(WidthClass::SimdPackingAlu,
+                            OperandShape::op2VectorMix(q, size, 2, 3, 0, 1),
                             size));
             break;
         case 0x7:
@@ -2257,17 +2721,17 @@ WidthDecoder<Impl>::decodeNeonZipUzpTrn(const DynInstPtr &inst)
                     "Neon ZIP2 inst decoded: %s. Size: %d, Q: %d.\n",
                     inst->staticInst->disassemble(inst->instAddr()),
                     size, q);
-            return(WidthInfo(WidthClass::SimdPackingAlu,
-                            widthOp2VectorJoin(inst, q, size, 2, 3, true),
+            return(WidthShape(WidthClass::SimdPackingAlu,
+                            OperandShape::op2VectorJoin(q, size, 2, 3, true),
                             size));
             break;
     }
 
-    return(WidthInfo(WidthClass::SimdNoInfo));
+    return(WidthShape(WidthClass::SimdNoInfo));
 }
 
 template <class Impl>
-WidthInfo
+WidthShape
 WidthDecoder<Impl>::decodeNeonTblTbx(const DynInstPtr &inst)
 {
     using namespace ArmISAInst;
@@ -2283,20 +2747,20 @@ WidthDecoder<Impl>::decodeNeonTblTbx(const DynInstPtr &inst)
                     "TBL (1 reg) inst decoded: %s. Q: %d.\n",
                     inst->staticInst->disassemble(inst->instAddr()),
                     q);
-            return(WidthInfo(WidthClass::SimdPackingAlu,
-                             widthOp1VectorRegl(inst, q, 1, 4), 1));
+            return(WidthShape(WidthClass::SimdPackingAlu,
+                             OperandShape::op1VectorRegl(q, 1, 4), 1));
             break;
         case 0x2:
             DPRINTF(WidthDecoderDecode,
                     "TBL (2 reg) inst decoded: %s. Q: %d.\n",
                     inst->staticInst->disassemble(inst->instAddr()),
                     q);
-            return(WidthInfo(WidthClass::SimdPackingAlu,
-                             widthOp2VectorRegl(inst, q, 1, 4, 5), 1));
+            return(WidthShape(WidthClass::SimdPackingAlu,
+                             OperandShape::op2VectorRegl(q, 1, 4, 5), 1));
             break;
     }
 
-    return(WidthInfo(WidthClass::SimdNoInfo));
+    return(WidthShape(WidthClass::SimdNoInfo));
 }
 
 template <class Impl>
@@ -2453,7 +2917,7 @@ WidthDecoder<Impl>::widthOp1ImmBroadcast(const DynInstPtr &inst,
 {
     VecWidthCode maskOp1;
 
-    int rsl = roundedPrcFunc(val);
+    int rsl = roundedPrc(val);
     DPRINTF(WidthDecoderWidth, "    Imm: val=%llx, rsl=%d\n",
             val, rsl);
     int eBits = 8 << size;
@@ -2478,6 +2942,54 @@ WidthDecoder<Impl>::widthOp1ImmBroadcast(const DynInstPtr &inst,
 }
 
 
+/// MPINHO 17-oct-2026 BEGIN ///
+template <class Impl>
+int
+WidthDecoder<Impl>::gprWidth(uint64_t val, int nBits)
+{
+    // Operations on W registers only see the low half of the register.
+    if (nBits < 64) {
+        val = bits(val, nBits - 1, 0);
+        if (widthDef == WidthDefinition::Signed && bits(val, nBits - 1))
+            val |= ~mask(nBits);
+    }
+
+    return std::min(roundedPrc(val), nBits);
+}
+
+template <class Impl>
+VecWidthCode
+WidthDecoder<Impl>::widthGprScalar(const DynInstPtr &inst,
+                                   uint8_t size, uint64_t imm)
+{
+    int nBits = 8 << size;
+    int rsl = imm ? gprWidth(imm, nBits) : 0;
+
+    // The order of the source operands depends on the instruction, so all
+    // the integer ones are considered.
+    for (int i = 0; i < inst->numSrcRegs(); i++) {
+        if (!inst->srcRegIdx(i).isIntReg())
+            continue;
+
+        uint64_t val = inst->readIntRegOperand(inst->staticInst.get(), i);
+        int op_rsl = gprWidth(val, nBits);
+
+        DPRINTF(WidthDecoderWidth, "    Gpr reg: val=%llx, rsl=%d\n",
+                val, op_rsl);
+
+        rsl = std::max(rsl, op_rsl);
+    }
+
+    // Scalar operations take a single lane of a scalar FU.
+    VecWidthCode maskRes(1, ScalarSizeBits, rsl);
+    DPRINTF(WidthDecoderWidth, "Scalar instruction has width mask %s"
+            " (eSize=%i).\n",
+            maskRes.to_string(),
+            size);
+    return maskRes;
+}
+/// MPINHO 17-oct-2026 END ///
+
 template <class Impl>
 VecWidthCode
 WidthDecoder<Impl>::widthOp2VectorRegl(const DynInstPtr &inst,
@@ -2639,7 +3151,7 @@ WidthDecoder<Impl>::widthOp2VectorWide(const DynInstPtr &inst,
 
 template <class Impl>
 void
-WidthDecoder<Impl>::sampleVecOp(VecWidthCode &mask, uint8_t size)
+WidthDecoder<Impl>::sampleVecOp(const VecWidthCode &mask, uint8_t size)
 {
     VecElemSize eSize = SizeToVecElemSize[size];
 
@@ -2652,7 +3164,7 @@ WidthDecoder<Impl>::sampleVecOp(VecWidthCode &mask, uint8_t size)
 
 template <class Impl>
 void
-WidthDecoder<Impl>::sampleVecInst(VecWidthCode &mask, uint8_t size)
+WidthDecoder<Impl>::sampleVecInst(const VecWidthCode &mask, uint8_t size)
 {
     VecElemSize eSize = SizeToVecElemSize[size];
 
@@ -2663,5 +3175,5 @@ WidthDecoder<Impl>::sampleVecInst(VecWidthCode &mask, uint8_t size)
     statVectorInstTotalWidthBySize[(int) eSize].sample(mask.totalWidth());
 }
 
-#endif // __CPU_O3_WIDTH_DECODER_IMPL_HH__
+#endif // __CPU_WIDTH_DECODER_IMPL_HH__
 /// MPINHO 12-mar-2019 END ///
@@ -0,0 +1,279 @@
+/// MPINHO 23-jul-2019 BEGIN ///
+
+#include "cpu/width_info.hh"
+#include "cpu/func_unit_width.hh"
+
+WidthInfo::WidthInfo()
+    : width_class(WidthClass::NoInfo),
+      elem_size(VecElemSize::Unknown)
+{}
+
+WidthInfo::WidthInfo(WidthClass _width_class)
+    : width_class(_width_class),
+      elem_size(VecElemSize::Unknown)
+{}
+
+WidthInfo::WidthInfo(WidthClass _width_class,
+                     const VecWidthCode &_width_mask,
+                     uint8_t _size)
+    : width_class(_width_class), width_mask(_width_mask)
+{
+    switch (_size) {
+        case 0:
+            elem_size = VecElemSize::Bit8;
+            break;
+
+        case 1:
+            elem_size = VecElemSize::Bit16;
+            break;
+
+        case 2:
+            elem_size = VecElemSize::Bit32;
+            break;
+
+        case 3:
+            elem_size = VecElemSize::Bit64;
+            break;
+
+        default:
+            panic("Invalid vector elem size: %d.", _size);
+            break;
+    }
+}
+
+bool
+WidthInfo::hasWidthInfo() const
+{
+    if (width_class == WidthClass::SimdNoPacking) return true;
+    if (width_class == WidthClass::SimdPackingAlu) return true;
+    if (width_class == WidthClass::SimdPackingMult) return true;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (width_class == WidthClass::IntPackingAlu) return true;
+    if (width_class == WidthClass::IntPackingMult) return true;
+    /// MPINHO 17-oct-2026 END ///
+
+    return false;
+}
+
+bool
+WidthInfo::isFuseType() const
+{
+    if (width_class == WidthClass::SimdPackingAlu) return true;
+    if (width_class == WidthClass::SimdPackingMult) return true;
+    /// MPINHO 17-oct-2026 BEGIN ///
+    if (width_class == WidthClass::IntPackingAlu) return true;
+    if (width_class == WidthClass::IntPackingMult) return true;
+    /// MPINHO 17-oct-2026 END ///
+
+    return false;
+}
+
+bool
+WidthInfo::matchType(const WidthInfo &b) const
+{
+    if (width_class == WidthClass::NoInfo ||
+        width_class == WidthClass::SimdNoPacking ||
+        b.width_class == WidthClass::NoInfo ||
+        b.width_class == WidthClass::SimdNoPacking) {
+        return false;
+    }
+
+    if (width_class != b.width_class) {
+        return false;
+    }
+
+    return true;
+}
+
+bool
+WidthInfo::canFuse(const WidthInfo &b,
+                   const PackingCriteria &packingCriteria) const
+{
+    if (!matchType(b))
+        return false;
+
+    return packingCriteria(width_mask, b.width_mask, nullptr);
+}
+
+std::string
+WidthInfo::to_string() const
+{
+    std::stringstream ss;
+
+    ss << WidthClassStrings[static_cast<int>(width_class)];
+
+    if (width_class != WidthClass::NoInfo &&
+        width_class != WidthClass::SimdNoInfo) {
+        ss << " (elem: "
+           << VecElemSizeStrings[static_cast<int>(elem_size)]
+           << ", total: "
+           << width_mask.totalWidth()
+           << ", mask: "
+           << width_mask.to_string();
+    }
+
+    return ss.str();
+}
+
+/// MPINHO 23-jul-2019 END ///
+
+/// MPINHO 17-oct-2026 BEGIN ///
+OperandShape
+OperandShape::op1VectorRegl(uint8_t q, uint8_t size, uint8_t op1)
+{
+    OperandShape shape;
+    shape.kind = Op1VectorRegl;
+    shape.q = q;
+    shape.size = size;
+    shape.op1 = op1;
+    return shape;
+}
+
+OperandShape
+OperandShape::op1VectorLong(uint8_t q, uint8_t size, uint8_t op1)
+{
+    OperandShape shape = op1VectorRegl(q, size, op1);
+    shape.kind = Op1VectorLong;
+    return shape;
+}
+
+OperandShape
+OperandShape::op1VectorPairLong(uint8_t q, uint8_t size, uint8_t op1)
+{
+    OperandShape shape = op1VectorRegl(q, size, op1);
+    shape.kind = Op1VectorPairLong;
+    return shape;
+}
+
+OperandShape
+OperandShape::op1VectorAcross(uint8_t q, uint8_t size, uint8_t op1)
+{
+    OperandShape shape = op1VectorRegl(q, size, op1);
+    shape.kind = Op1VectorAcross;
+    return shape;
+}
+
+OperandShape
+OperandShape::op1VectorIndex(uint8_t size, uint8_t op1, uint8_t idx)
+{
+    OperandShape shape;
+    shape.kind = Op1VectorIndex;
+    shape.size = size;
+    shape.op1 = op1;
+    shape.idx = idx;
+    return shape;
+}
+
+OperandShape
+OperandShape::op1VectorBroadcast(uint8_t q, uint8_t size, uint8_t op1,
+                                 uint8_t idx)
+{
+    OperandShape shape = op1VectorRegl(q, size, op1);
+    shape.kind = Op1VectorBroadcast;
+    shape.idx = idx;
+    return shape;
+}
+
+OperandShape
+OperandShape::op1GprBroadcast(uint8_t q, uint8_t size, uint8_t op1)
+{
+    OperandShape shape = op1VectorRegl(q, size, op1);
+    shape.kind = Op1GprBroadcast;
+    return shape;
+}
+
+OperandShape
+OperandShape::op1ImmBroadcast(uint8_t q, uint8_t size, uint64_t imm)
+{
+    OperandShape shape;
+    shape.kind = Op1ImmBroadcast;
+    shape.q = q;
+    shape.size = size;
+    shape.imm = imm;
+    return shape;
+}
+
+OperandShape
+OperandShape::op2VectorRegl(uint8_t q, uint8_t size, uint8_t op1,
+                            uint8_t op2)
+{
+    OperandShape shape = op1VectorRegl(q, size, op1);
+    shape.kind = Op2VectorRegl;
+    shape.op2 = op2;
+    return shape;
+}
+
+OperandShape
+OperandShape::op2VectorPair(uint8_t q, uint8_t size, uint8_t op1,
+                            uint8_t op2)
+{
+    OperandShape shape = op2VectorRegl(q, size, op1, op2);
+    shape.kind = Op2VectorPair;
+    return shape;
+}
+
+OperandShape
+OperandShape::op2VectorMix(uint8_t q, uint8_t size, uint8_t op1,
+                           uint8_t op2, int idx, int stride)
+{
+    OperandShape shape = op2VectorRegl(q, size, op1, op2);
+    shape.kind = Op2VectorMix;
+    shape.idx = idx;
+    shape.stride = stride;
+    return shape;
+}
+
+OperandShape
+OperandShape::op2VectorJoin(uint8_t q, uint8_t size, uint8_t op1,
+                            uint8_t op2, bool lower)
+{
+    OperandShape shape = op2VectorRegl(q, size, op1, op2);
+    shape.kind = Op2VectorJoin;
+    shape.lower = lower;
+    return shape;
+}
+
+OperandShape
+OperandShape::op2VectorLong(uint8_t q, uint8_t size, uint8_t op1,
+                            uint8_t op2)
+{
+    OperandShape shape = op2VectorRegl(q, size, op1, op2);
+    shape.kind = Op2VectorLong;
+    return shape;
+}
+
+OperandShape
+OperandShape::op2VectorWide(uint8_t q, uint8_t size, uint8_t op1,
+                            uint8_t op2)
+{
+    OperandShape shape = op2VectorRegl(q, size, op1, op2);
+    shape.kind = Op2VectorWide;
+    return shape;
+}
+
+OperandShape
+OperandShape::gprScalar(uint8_t size, uint64_t imm)
+{
+    OperandShape shape;
+    shape.kind = GprScalar;
+    shape.size = size;
+    shape.imm = imm;
+    return shape;
+}
+
+WidthShape::WidthShape()
+    : width_class(WidthClass::NoInfo),
+      size(0)
+{}
+
+WidthShape::WidthShape(WidthClass _width_class)
+    : width_class(_width_class),
+      size(0)
+{}
+
+WidthShape::WidthShape(WidthClass _width_class,
+                       OperandShape _operands,
+                       uint8_t _size)
+    : width_class(_width_class), operands(_operands), size(_size)
+{}
+/// MPINHO 17-oct-2026 END ///
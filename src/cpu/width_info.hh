@@ -0,0 +1,154 @@
+/// MPINHO 23-jul-2019 BEGIN ///
+#ifndef __CPU_WIDTH_INFO_HH_
+#define __CPU_WIDTH_INFO_HH_
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "arch/utility.hh"
+#include "cpu/packing_criteria.hh"
+#include "cpu/width_code.hh"
+#include "enums/VecElemSize.hh"
+#include "enums/WidthClass.hh"
+
+/*
+ * Type for the width information associated with an instruction.
+ *
+ * Used to verify the width used by the instruction and to check if two
+ * instructions can be fused.
+ */
+class WidthInfo {
+    protected:
+        WidthClass width_class;
+        VecWidthCode width_mask;
+        VecElemSize elem_size;
+
+    public:
+        WidthInfo();
+        WidthInfo(WidthClass _width_class);
+        WidthInfo(WidthClass _width_class, const VecWidthCode &_width_mask,
+                  uint8_t _size);
+
+        WidthClass getWidthClass() const { return width_class; }
+        int getWidthVal() const { return width_mask.totalWidth(); }
+        VecElemSize getElemSize() const { return elem_size; }
+        const VecWidthCode &getWidthMask() const { return width_mask; }
+        bool hasWidthInfo() const;
+        bool isFuseType() const;
+        bool matchType(const WidthInfo &b) const;
+        bool canFuse(const WidthInfo &b,
+                     const PackingCriteria &packingCriteria) const;
+        std::string to_string() const;
+};
+
+/// MPINHO 17-oct-2026 BEGIN ///
+/*
+ * Describes how the width mask of an instruction is obtained from its
+ * operands: which operands are read, how their lanes are laid out and how
+ * they are combined. Only depends on the instruction encoding.
+ */
+struct OperandShape {
+    enum Kind {
+        None,
+        Op1VectorRegl,
+        Op1VectorLong,
+        Op1VectorPairLong,
+        Op1VectorAcross,
+        Op1VectorIndex,
+        Op1VectorBroadcast,
+        Op1GprBroadcast,
+        Op1ImmBroadcast,
+        Op2VectorRegl,
+        Op2VectorPair,
+        Op2VectorMix,
+        Op2VectorJoin,
+        Op2VectorLong,
+        Op2VectorWide,
+        GprScalar
+    };
+
+    Kind kind;
+    uint8_t q;
+    uint8_t size;
+    uint8_t op1;
+    uint8_t op2;
+    uint8_t idx;
+    int stride;
+    bool lower;
+    uint64_t imm;
+
+    OperandShape()
+        : kind(None), q(0), size(0), op1(0), op2(0), idx(0), stride(0),
+          lower(false), imm(0)
+    {}
+
+    static OperandShape
+    op1VectorRegl(uint8_t q, uint8_t size, uint8_t op1);
+    static OperandShape
+    op1VectorLong(uint8_t q, uint8_t size, uint8_t op1);
+    static OperandShape
+    op1VectorPairLong(uint8_t q, uint8_t size, uint8_t op1);
+    static OperandShape
+    op1VectorAcross(uint8_t q, uint8_t size, uint8_t op1);
+    static OperandShape
+    op1VectorIndex(uint8_t size, uint8_t op1, uint8_t idx);
+    static OperandShape
+    op1VectorBroadcast(uint8_t q, uint8_t size, uint8_t op1, uint8_t idx);
+    static OperandShape
+    op1GprBroadcast(uint8_t q, uint8_t size, uint8_t op1);
+    static OperandShape
+    op1ImmBroadcast(uint8_t q, uint8_t size, uint64_t imm);
+    static OperandShape
+    op2VectorRegl(uint8_t q, uint8_t size, uint8_t op1, uint8_t op2);
+    static OperandShape
+    op2VectorPair(uint8_t q, uint8_t size, uint8_t op1, uint8_t op2);
+    static OperandShape
+    op2VectorMix(uint8_t q, uint8_t size, uint8_t op1, uint8_t op2,
+                 int idx, int stride);
+    static OperandShape
+    op2VectorJoin(uint8_t q, uint8_t size, uint8_t op1, uint8_t op2,
+                  bool lower);
+    static OperandShape
+    op2VectorLong(uint8_t q, uint8_t size, uint8_t op1, uint8_t op2);
+    static OperandShape
+    op2VectorWide(uint8_t q, uint8_t size, uint8_t op1, uint8_t op2);
+    /**
+     * Scalar integer operation, as wide as its widest integer source
+     * register or immediate.
+     */
+    static OperandShape
+    gprScalar(uint8_t size, uint64_t imm);
+};
+
+/*
+ * Encoding derived part of the width information of an instruction: width
+ * class, element size and operand shape. As it does not depend on operand
+ * values, it can be decoded once per static instruction and then used to
+ * build the WidthInfo of every dynamic instance.
+ */
+class WidthShape {
+    protected:
+        WidthClass width_class;
+        OperandShape operands;
+        uint8_t size;
+
+    public:
+        WidthShape();
+        WidthShape(WidthClass _width_class);
+        WidthShape(WidthClass _width_class, OperandShape _operands,
+                   uint8_t _size);
+
+        WidthClass getWidthClass() const { return width_class; }
+        const OperandShape &getOperands() const { return operands; }
+        uint8_t getSize() const { return size; }
+        bool
+        hasOperands() const
+        {
+            return operands.kind != OperandShape::None;
+        }
+};
+/// MPINHO 17-oct-2026 END ///
+
+#endif // __CPU_WIDTH_INFO_HH_
+/// MPINHO 23-jul-2019 END ///
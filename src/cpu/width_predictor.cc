@@ -0,0 +1,87 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+
+#include "cpu/width_predictor.hh"
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+WidthPredictor::WidthPredictor()
+    : indexMask(0),
+      threshold(0)
+{}
+
+void
+WidthPredictor::init(unsigned size, unsigned counter_bits,
+                     unsigned _threshold)
+{
+    if (!isPowerOf2(size)) {
+        fatal("Invalid width predictor size (%u), must be a power of 2.\n",
+              size);
+    }
+    if (_threshold >= (1u << counter_bits)) {
+        fatal("Width predictor threshold (%u) is not reachable with"
+              " %u-bit counters.\n", _threshold, counter_bits);
+    }
+
+    table.assign(size, Entry());
+    for (auto &entry : table) {
+        entry.confidence.setBits(counter_bits);
+    }
+
+    indexMask = size - 1;
+    threshold = _threshold;
+}
+
+bool
+WidthPredictor::lookup(Addr pc, WidthInfo &width) const
+{
+    const Entry &entry = table[index(pc)];
+
+    if (!entry.valid || entry.tag != pc ||
+        entry.confidence.read() < threshold) {
+        return false;
+    }
+
+    width = entry.width;
+    return true;
+}
+
+void
+WidthPredictor::update(Addr pc, const WidthInfo &width)
+{
+    Entry &entry = table[index(pc)];
+
+    if (entry.valid && entry.tag == pc && covers(entry.width, width)) {
+        entry.confidence.increment();
+        return;
+    }
+
+    entry.valid = true;
+    entry.tag = pc;
+    entry.width = width;
+    entry.confidence.reset();
+}
+
+bool
+WidthPredictor::covers(const WidthInfo &predicted, const WidthInfo &actual)
+{
+    if (predicted.getWidthClass() != actual.getWidthClass() ||
+        predicted.getElemSize() != actual.getElemSize()) {
+        return false;
+    }
+
+    const VecWidthCode &pred_mask = predicted.getWidthMask();
+    const VecWidthCode &mask = actual.getWidthMask();
+
+    if (!pred_mask.match(mask))
+        return false;
+
+    for (int i = 0; i < mask.numElem(); i++) {
+        if (mask.get(i) > pred_mask.get(i))
+            return false;
+    }
+
+    return true;
+}
+
+/// MPINHO 17-oct-2026 END ///
@@ -0,0 +1,76 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+#ifndef __CPU_WIDTH_PREDICTOR_HH__
+#define __CPU_WIDTH_PREDICTOR_HH__
+
+#include <vector>
+
+#include "base/types.hh"
+#include "cpu/width_info.hh"
+#include "cpu/pred/sat_counter.hh"
+
+/**
+ * PC indexed predictor of the width of an instruction.
+ *
+ * Each entry keeps the last width seen for a PC and a confidence counter.
+ * The counter grows while the width of the instruction stays within the
+ * predicted one, and is reset otherwise. A prediction is only given when
+ * the counter reaches the threshold.
+ */
+class WidthPredictor
+{
+  private:
+    /** Predictor entry. */
+    struct Entry
+    {
+        /** Whether the entry holds a width. */
+        bool valid;
+        /** PC of the instruction the entry belongs to. */
+        Addr tag;
+        /** Last width seen. */
+        WidthInfo width;
+        /** Confidence on the width. */
+        SatCounter confidence;
+
+        Entry() : valid(false), tag(0) {}
+    };
+
+    /** Predictor table. */
+    std::vector<Entry> table;
+
+    /** Mask to index the table. */
+    Addr indexMask;
+
+    /** Confidence needed to give a prediction. */
+    unsigned threshold;
+
+    /** Returns the entry of a PC. */
+    unsigned index(Addr pc) const { return (pc >> 2) & indexMask; }
+
+  public:
+    WidthPredictor();
+
+    /** Sets the size of the predictor and of its counters. */
+    void init(unsigned size, unsigned counter_bits, unsigned threshold);
+
+    /** Whether the predictor was given a table. */
+    bool enabled() const { return !table.empty(); }
+
+    /**
+     * Looks up the width of the instruction in a PC. Returns true, and the
+     * predicted width, if confident.
+     */
+    bool lookup(Addr pc, WidthInfo &width) const;
+
+    /** Trains the predictor with the actual width of an instruction. */
+    void update(Addr pc, const WidthInfo &width);
+
+    /**
+     * Returns true if the actual width of an instruction is within the
+     * predicted one: same width class and element size, and no lane
+     * wider than predicted.
+     */
+    static bool covers(const WidthInfo &predicted, const WidthInfo &actual);
+};
+
+#endif // __CPU_WIDTH_PREDICTOR_HH__
+/// MPINHO 17-oct-2026 END ///
@@ -57,6 +57,7 @@
 #include "base/statistics.hh"
 #include "base/time.hh"
 #include "cpu/base.hh"
+#include "cpu/decode_cache.hh" /// MPINHO 17-oct-2026 ///
 #include "sim/global_event.hh"
 
 using namespace std;
@@ -106,6 +107,18 @@ statFinalTick()
 
 SimTicksReset simTicksReset;
 
+/// MPINHO 17-oct-2026 BEGIN ///
+struct DecodeCacheReset : public Callback
+{
+    void process()
+    {
+        DecodeCache::counts = DecodeCache::Counts();
+    }
+};
+
+DecodeCacheReset decodeCacheReset;
+/// MPINHO 17-oct-2026 END ///
+
 struct Global
 {
     Stats::Formula hostInstRate;
@@ -117,6 +130,15 @@ struct Global
     Stats::Value simInsts;
     Stats::Value simOps;
 
+    /// MPINHO 17-oct-2026 BEGIN ///
+    Stats::Value decodeCachePageHits;
+    Stats::Value decodeCachePageMisses;
+    Stats::Value decodeCacheAddrHits;
+    Stats::Value decodeCacheInstHits;
+    Stats::Value decodeCacheInstMisses;
+    Stats::Formula decodeCacheHitRate;
+    /// MPINHO 17-oct-2026 END ///
+
     Global();
 };
 
@@ -202,6 +224,54 @@ Global::Global()
     hostTickRate = simTicks / hostSeconds;
 
     registerResetCallback(&simTicksReset);
+
+    /// MPINHO 17-oct-2026 BEGIN ///
+    decodeCachePageHits
+        .scalar(DecodeCache::counts.pageHits)
+        .name("decode_cache_page_hits")
+        .desc("Decode cache address lookups hitting in a page table")
+        .prereq(decodeCachePageHits)
+        ;
+
+    decodeCachePageMisses
+        .scalar(DecodeCache::counts.pageMisses)
+        .name("decode_cache_page_misses")
+        .desc("Decode cache address lookups searching the map of pages")
+        .prereq(decodeCachePageMisses)
+        ;
+
+    decodeCacheAddrHits
+        .scalar(DecodeCache::counts.addrHits)
+        .name("decode_cache_addr_hits")
+        .desc("Decodes of the instruction last decoded at the same address")
+        .prereq(decodeCacheAddrHits)
+        ;
+
+    decodeCacheInstHits
+        .scalar(DecodeCache::counts.instHits)
+        .name("decode_cache_inst_hits")
+        .desc("Decodes found in the decoded instruction hash")
+        .prereq(decodeCacheInstHits)
+        ;
+
+    decodeCacheInstMisses
+        .scalar(DecodeCache::counts.instMisses)
+        .name("decode_cache_inst_misses")
+        .desc("Instructions decoded because they were not cached")
+        .prereq(decodeCacheInstMisses)
+        ;
+
+    decodeCacheHitRate
+        .name("decode_cache_hit_rate")
+        .desc("Fraction of decodes served by the decode cache")
+        .precision(6)
+        ;
+
+    decodeCacheHitRate = (decodeCacheAddrHits + decodeCacheInstHits) /
+        (decodeCacheAddrHits + decodeCacheInstHits + decodeCacheInstMisses);
+
+    registerResetCallback(&decodeCacheReset);
+    /// MPINHO 17-oct-2026 END ///
 }
 
 void
@@ -0,0 +1,87 @@
+/// MPINHO 17-oct-2026 BEGIN ///
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/pool_alloc.hh"
+#include "base/refcnt.hh"
+
+using namespace std;
+
+/**
+ * Times the allocation of pipeline instructions through a BlockPool against
+ * plain new/delete, the way MinorDynInsts are recycled: each instruction is
+ * held through a reference counted pointer in a ring of in-flight slots, and
+ * freed when its slot is reused.
+ */
+
+/** Bytes of state carried by an instruction, about a MinorDynInst. */
+const size_t PayloadBytes = 440;
+
+/** Number of instructions in flight. */
+const size_t InFlight = 64;
+
+template <bool Pooled>
+class Inst : public RefCounted
+{
+  public:
+    char payload[PayloadBytes];
+
+    static void *
+    operator new(size_t size)
+    {
+        if (!Pooled || size != sizeof(Inst))
+            return ::operator new(size);
+        return BlockPool<sizeof(Inst)>::allocate();
+    }
+
+    static void
+    operator delete(void *ptr, size_t size)
+    {
+        if (!Pooled || size != sizeof(Inst))
+            ::operator delete(ptr);
+        else
+            BlockPool<sizeof(Inst)>::release(ptr);
+    }
+};
+
+template <bool Pooled>
+double
+do_test(size_t iterations)
+{
+    typedef RefCountingPtr<Inst<Pooled> > InstPtr;
+
+    vector<InstPtr> ring(InFlight);
+
+    auto start = chrono::steady_clock::now();
+
+    for (size_t i = 0; i < iterations; i++) {
+        InstPtr &slot = ring[i % InFlight];
+        slot = new Inst<Pooled>;
+        slot->payload[0] = i;
+    }
+    ring.clear();
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+int
+main(int argc, char *argv[])
+{
+    size_t iterations = argc > 1 ? strtoul(argv[1], NULL, 0) : 50000000;
+
+    double heap = do_test<false>(iterations);
+    double pool = do_test<true>(iterations);
+
+    cprintf("%d insts of %d bytes, %d in flight\n",
+            iterations, sizeof(Inst<true>), InFlight);
+    cprintf("new/delete: %.3fs, %.0f insts/s\n", heap, iterations / heap);
+    cprintf("block pool: %.3fs, %.0f insts/s\n", pool, iterations / pool);
+    cprintf("speedup: %.2fx\n", heap / pool);
+
+    return 0;
+}
+/// MPINHO 17-oct-2026 END ///
@@ -0,0 +1,105 @@
+### MPINHO 17-oct-2026 BEGIN ###
+'''
+Test file for the O3 quiescent tick skip (--quiescent-skip).
+
+Skipping the tick while the pipeline waits on memory or on a long latency
+op must not change the simulated timing: a run must end at the same tick
+and commit the same number of instructions with and without the skip. The
+run without caches is DRAM bound, so almost every fetch is a skip period.
+'''
+import os
+import re
+
+from testlib import *
+from testlib.helper import log_call
+from testlib.suite import TestSuite
+from testlib.test import TestFunction
+
+test_progs = {
+    'x86': ('hello64-static',),
+    'arm': ('hello64-static',),
+}
+
+cache_configs = {
+    'nocache': [],
+    'caches': ['--caches'],
+}
+
+skip_cycles = 1000
+
+# Stats that must match between the runs.
+timing_stats = ('sim_ticks', 'system.cpu.committedInsts')
+
+stat_regex = re.compile(r'^(\S+)\s+(\S+)')
+
+def read_stats(fname):
+    stats = {}
+    with open(fname) as f:
+        for line in f:
+            match = stat_regex.match(line)
+            if match:
+                stats[match.group(1)] = match.group(2)
+    return stats
+
+def create_run_gem5(outdir, config_args):
+    def test_run_gem5(params):
+        fixtures = params.fixtures
+        tempdir = fixtures[constants.tempdir_fixture_name].path
+        gem5 = fixtures[constants.gem5_binary_fixture_name].path
+        command = [
+            gem5,
+            '-d',
+            joinpath(tempdir, outdir),
+            '-re',
+            joinpath(config.base_dir, 'configs', 'example', 'se.py'),
+        ]
+        command.extend(config_args)
+        if log_call(params.log, command) != 0:
+            raise Exception('gem5 run in %s failed' % outdir)
+    return test_run_gem5
+
+def test_compare_stats(params):
+    tempdir = params.fixtures[constants.tempdir_fixture_name].path
+    base = read_stats(joinpath(tempdir, 'noskip', 'stats.txt'))
+    skip = read_stats(joinpath(tempdir, 'skip', 'stats.txt'))
+
+    # The stat is only printed once a skip happened.
+    if 'system.cpu.quiescentSkips' not in skip:
+        raise Exception('No quiescent tick skip, see %s' % tempdir)
+
+    for stat in timing_stats:
+        if stat not in base or base[stat] != skip.get(stat):
+            raise Exception('%s differs: %s without skip, %s with skip'
+                            % (stat, base.get(stat), skip.get(stat)))
+
+for isa in test_progs:
+    for binary in test_progs[isa]:
+        path = os.path.join('test-progs', 'hello', 'bin', isa, 'linux')
+        hello_program = DownloadedProgram(path, binary)
+
+        for cache_name, cache_args in cache_configs.items():
+            config_args = ['--cpu-type=DerivO3CPU',
+                           '--cmd', hello_program.path] + cache_args
+
+            for opt in constants.supported_variants:
+                name = 'quiescent_skip_{}_{}-{}-{}'.format(
+                        binary, cache_name, isa.upper(), opt)
+
+                tests = [
+                    TestFunction(create_run_gem5('noskip', config_args),
+                                 name=name + '-noskip'),
+                    TestFunction(create_run_gem5('skip', config_args +
+                                     ['--quiescent-skip=%d' % skip_cycles]),
+                                 name=name + '-skip'),
+                    TestFunction(test_compare_stats,
+                                 name=name + '-compare'),
+                ]
+
+                TestSuite(
+                    name=name,
+                    fixtures=[hello_program,
+                              Gem5Fixture(isa.upper(), opt),
+                              TempdirFixture()],
+                    tags=[isa.upper(), opt, constants.supported_lengths[0]],
+                    tests=tests)
+### MPINHO 17-oct-2026 END ###